@@ -3,6 +3,7 @@
 /// \defgroup grit-audio Audio
 
 #include <grit/audio/airwindows.hpp>
+#include <grit/audio/convolution.hpp>
 #include <grit/audio/delay.hpp>
 #include <grit/audio/dynamic.hpp>
 #include <grit/audio/envelope.hpp>
@@ -11,5 +12,6 @@
 #include <grit/audio/music.hpp>
 #include <grit/audio/noise.hpp>
 #include <grit/audio/oscillator.hpp>
+#include <grit/audio/processor.hpp>
 #include <grit/audio/stereo.hpp>
 #include <grit/audio/waveshape.hpp>
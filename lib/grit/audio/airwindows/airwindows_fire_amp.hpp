@@ -1,5 +1,6 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/math/static_lookup_table_transform.hpp>
 
 #include <etl/algorithm.hpp>
@@ -10,10 +11,11 @@
 namespace grit {
 
 /// \ingroup grit-audio-airwindows
-template<etl::floating_point Float, typename URNG = etl::xoshiro128plusplus>
+template<Lane Sample, typename URNG = etl::xoshiro128plusplus>
 struct AirWindowsFireAmp
 {
-    using SampleType = Float;
+    using SampleType = Sample;
+    using Float      = LaneValue<Sample>;
     using SeedType   = typename URNG::result_type;
 
     struct Parameter
@@ -30,7 +32,7 @@ struct AirWindowsFireAmp
     auto setParameter(Parameter parameter) -> void;
     auto setSampleRate(Float sampleRate) -> void;
 
-    [[nodiscard]] auto operator()(Float x) -> Float;
+    [[nodiscard]] auto operator()(Sample x) -> Sample;
     auto reset() -> void;
 
 private:
@@ -40,54 +42,66 @@ private:
         Float(1.57079633),
     };
 
+    /// sin(x) per lane, saturated at pi/2
+    [[nodiscard]] static constexpr auto sineClip(Sample x) -> Sample
+    {
+        return lanewise([](Float v) { return sineLUT(etl::min(v, Float(1.57079633))); }, x);
+    }
+
+    /// magnitude, negated in the lanes where polarity isn't positive
+    [[nodiscard]] static constexpr auto withPolarity(Sample polarity, Sample magnitude) -> Sample
+    {
+        return lanewise([](Float p, Float m) { return p > Float(0) ? m : -m; }, polarity, magnitude);
+    }
+
     URNG _rng{42};
     etl::uniform_real_distribution<Float> _dist{Float(0), Float(1)};
 
     Parameter _parameter{};
     Float _sampleRate{};
 
-    Float _lastSampleL{0};
-    Float _storeSampleL{0};
-    Float _smoothAl{0};
-    Float _smoothBl{0};
-    Float _smoothCl{0};
-    Float _smoothDl{0};
-    Float _smoothEl{0};
-    Float _smoothFl{0};
-    Float _smoothGl{0};
-    Float _smoothHl{0};
-    Float _smoothIl{0};
-    Float _smoothJl{0};
-    Float _smoothKl{0};
-    Float _smoothLl{0};
-    Float _iirSampleAl{0};
-    Float _iirSampleBl{0};
-    Float _iirSampleCl{0};
-    Float _iirSampleDl{0};
-    Float _iirSampleEl{0};
-    Float _iirSampleFl{0};
-    Float _iirSampleGl{0};
-    Float _iirSampleHl{0};
-    Float _iirSampleIl{0};
-    Float _iirSampleJl{0};
-    Float _iirSampleKl{0};
-    Float _iirSampleLl{0};
-    Float _iirLowpassL{0};
-    Float _iirSpkAl{0};
-    Float _iirSpkBl{0};
-    Float _iirSubL{0};
-    Float _oddL[257]{0};
-    Float _evenL[257]{0};
+    Sample _lastSampleL{};
+    Sample _storeSampleL{};
+    Sample _smoothAl{};
+    Sample _smoothBl{};
+    Sample _smoothCl{};
+    Sample _smoothDl{};
+    Sample _smoothEl{};
+    Sample _smoothFl{};
+    Sample _smoothGl{};
+    Sample _smoothHl{};
+    Sample _smoothIl{};
+    Sample _smoothJl{};
+    Sample _smoothKl{};
+    Sample _smoothLl{};
+    Sample _iirSampleAl{};
+    Sample _iirSampleBl{};
+    Sample _iirSampleCl{};
+    Sample _iirSampleDl{};
+    Sample _iirSampleEl{};
+    Sample _iirSampleFl{};
+    Sample _iirSampleGl{};
+    Sample _iirSampleHl{};
+    Sample _iirSampleIl{};
+    Sample _iirSampleJl{};
+    Sample _iirSampleKl{};
+    Sample _iirSampleLl{};
+    Sample _iirLowpassL{};
+    Sample _iirSpkAl{};
+    Sample _iirSpkBl{};
+    Sample _iirSubL{};
+    Sample _oddL[257]{};
+    Sample _evenL[257]{};
 
     bool _flip{false};
     int _count{0};  // amp
 
-    Float _bL[90]{0};
-    Float _lastCabSampleL{0};
-    Float _smoothCabAl{0};
-    Float _smoothCabBl{0};  // cab
+    Sample _bL[90]{};
+    Sample _lastCabSampleL{};
+    Sample _smoothCabAl{};
+    Sample _smoothCabBl{};  // cab
 
-    Float _lastRefL[10]{0};
+    Sample _lastRefL[10]{};
     int _cycle{0};  // undersampling
 
     enum
@@ -99,9 +113,14 @@ private:
         FixA2,
         FixB1,
         FixB2,
+        FixTotal
+    };
+
+    enum
+    {
         FixSL1,
         FixSL2,
-        FixTotal
+        FixStateTotal
     };
 
     Float _fixA[FixTotal]{0};
@@ -111,6 +130,13 @@ private:
     Float _fixE[FixTotal]{0};
     Float _fixF[FixTotal]{0};  // filtering
 
+    Sample _fixStateA[FixStateTotal]{};
+    Sample _fixStateB[FixStateTotal]{};
+    Sample _fixStateC[FixStateTotal]{};
+    Sample _fixStateD[FixStateTotal]{};
+    Sample _fixStateE[FixStateTotal]{};
+    Sample _fixStateF[FixStateTotal]{};
+
     Float _startlevel{0};
     Float _bassfill{0};
     Float _outputlevel{0};
@@ -126,14 +152,14 @@ private:
     int _side{0};
 };
 
-template<etl::floating_point Float, typename URNG>
-AirWindowsFireAmp<Float, URNG>::AirWindowsFireAmp(SeedType seed) : _rng{seed}
+template<Lane Sample, typename URNG>
+AirWindowsFireAmp<Sample, URNG>::AirWindowsFireAmp(SeedType seed) : _rng{seed}
 {
     reset();
 }
 
-template<etl::floating_point Float, typename URNG>
-auto AirWindowsFireAmp<Float, URNG>::setParameter(Parameter parameter) -> void
+template<Lane Sample, typename URNG>
+auto AirWindowsFireAmp<Sample, URNG>::setParameter(Parameter parameter) -> void
 {
     _parameter = parameter;
 
@@ -232,24 +258,24 @@ auto AirWindowsFireAmp<Float, URNG>::setParameter(Parameter parameter) -> void
     _fixF[FixB2] = (Float(1) - k / _fixF[FixReso] + k * k) * norm;
 }
 
-template<etl::floating_point Float, typename URNG>
-auto AirWindowsFireAmp<Float, URNG>::setSampleRate(Float sampleRate) -> void
+template<Lane Sample, typename URNG>
+auto AirWindowsFireAmp<Sample, URNG>::setSampleRate(Float sampleRate) -> void
 {
     _sampleRate = sampleRate;
     reset();
     setParameter(_parameter);
 }
 
-template<etl::floating_point Float, typename URNG>
-auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
+template<Lane Sample, typename URNG>
+auto AirWindowsFireAmp<Sample, URNG>::operator()(Sample const x) -> Sample
 {
     auto inputSampleL = x;
     auto drySampleL   = inputSampleL;
 
-    auto outSample = (inputSampleL * _fixA[FixA0]) + _fixA[FixSL1];
-    _fixA[FixSL1]  = (inputSampleL * _fixA[FixA1]) - (outSample * _fixA[FixB1]) + _fixA[FixSL2];
-    _fixA[FixSL2]  = (inputSampleL * _fixA[FixA2]) - (outSample * _fixA[FixB2]);
-    inputSampleL   = etl::clamp(outSample, Float(-1), Float(+1));  // fixed biquad filtering ultrasonics
+    auto outSample = (inputSampleL * _fixA[FixA0]) + _fixStateA[FixSL1];
+    _fixStateA[FixSL1]  = (inputSampleL * _fixA[FixA1]) - (outSample * _fixA[FixB1]) + _fixStateA[FixSL2];
+    _fixStateA[FixSL2]  = (inputSampleL * _fixA[FixA2]) - (outSample * _fixA[FixB2]);
+    inputSampleL   = laneClamp(outSample, Float(-1), Float(+1));  // fixed biquad filtering ultrasonics
 
     auto basscutL = Float(0.98);
     // we're going to be shifting this as the stages progress
@@ -260,7 +286,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleAl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     auto bridgerectifier = (_smoothAl + inputSampleL);
     _smoothAl            = inputSampleL;
@@ -272,16 +298,16 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleBl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothBl + inputSampleL);
     _smoothBl       = inputSampleL;
     inputSampleL    = bridgerectifier;
     // two-sample averaging lowpass
 
-    outSample     = (inputSampleL * _fixB[FixA0]) + _fixB[FixSL1];
-    _fixB[FixSL1] = (inputSampleL * _fixB[FixA1]) - (outSample * _fixB[FixB1]) + _fixB[FixSL2];
-    _fixB[FixSL2] = (inputSampleL * _fixB[FixA2]) - (outSample * _fixB[FixB2]);
+    outSample     = (inputSampleL * _fixB[FixA0]) + _fixStateB[FixSL1];
+    _fixStateB[FixSL1] = (inputSampleL * _fixB[FixA1]) - (outSample * _fixB[FixB1]) + _fixStateB[FixSL2];
+    _fixStateB[FixSL2] = (inputSampleL * _fixB[FixA2]) - (outSample * _fixB[FixB2]);
     inputSampleL  = outSample;  // fixed biquad filtering ultrasonics
 
     inputSampleL *= inputlevelL;
@@ -290,7 +316,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleCl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothCl + inputSampleL);
     _smoothCl       = inputSampleL;
@@ -302,16 +328,16 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleDl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothDl + inputSampleL);
     _smoothDl       = inputSampleL;
     inputSampleL    = bridgerectifier;
     // two-sample averaging lowpass
 
-    outSample     = (inputSampleL * _fixC[FixA0]) + _fixC[FixSL1];
-    _fixC[FixSL1] = (inputSampleL * _fixC[FixA1]) - (outSample * _fixC[FixB1]) + _fixC[FixSL2];
-    _fixC[FixSL2] = (inputSampleL * _fixC[FixA2]) - (outSample * _fixC[FixB2]);
+    outSample     = (inputSampleL * _fixC[FixA0]) + _fixStateC[FixSL1];
+    _fixStateC[FixSL1] = (inputSampleL * _fixC[FixA1]) - (outSample * _fixC[FixB1]) + _fixStateC[FixSL2];
+    _fixStateC[FixSL2] = (inputSampleL * _fixC[FixA2]) - (outSample * _fixC[FixB2]);
     inputSampleL  = outSample;  // fixed biquad filtering ultrasonics
 
     inputSampleL *= inputlevelL;
@@ -320,7 +346,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleEl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothEl + inputSampleL);
     _smoothEl       = inputSampleL;
@@ -332,16 +358,16 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleFl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothFl + inputSampleL);
     _smoothFl       = inputSampleL;
     inputSampleL    = bridgerectifier;
     // two-sample averaging lowpass
 
-    outSample     = (inputSampleL * _fixD[FixA0]) + _fixD[FixSL1];
-    _fixD[FixSL1] = (inputSampleL * _fixD[FixA1]) - (outSample * _fixD[FixB1]) + _fixD[FixSL2];
-    _fixD[FixSL2] = (inputSampleL * _fixD[FixA2]) - (outSample * _fixD[FixB2]);
+    outSample     = (inputSampleL * _fixD[FixA0]) + _fixStateD[FixSL1];
+    _fixStateD[FixSL1] = (inputSampleL * _fixD[FixA1]) - (outSample * _fixD[FixB1]) + _fixStateD[FixSL2];
+    _fixStateD[FixSL2] = (inputSampleL * _fixD[FixA2]) - (outSample * _fixD[FixB2]);
     inputSampleL  = outSample;  // fixed biquad filtering ultrasonics
 
     inputSampleL *= inputlevelL;
@@ -350,7 +376,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleGl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothGl + inputSampleL);
     _smoothGl       = inputSampleL;
@@ -362,16 +388,16 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleHl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothHl + inputSampleL);
     _smoothHl       = inputSampleL;
     inputSampleL    = bridgerectifier;
     // two-sample averaging lowpass
 
-    outSample     = (inputSampleL * _fixE[FixA0]) + _fixE[FixSL1];
-    _fixE[FixSL1] = (inputSampleL * _fixE[FixA1]) - (outSample * _fixE[FixB1]) + _fixE[FixSL2];
-    _fixE[FixSL2] = (inputSampleL * _fixE[FixA2]) - (outSample * _fixE[FixB2]);
+    outSample     = (inputSampleL * _fixE[FixA0]) + _fixStateE[FixSL1];
+    _fixStateE[FixSL1] = (inputSampleL * _fixE[FixA1]) - (outSample * _fixE[FixB1]) + _fixStateE[FixSL2];
+    _fixStateE[FixSL2] = (inputSampleL * _fixE[FixA2]) - (outSample * _fixE[FixB2]);
     inputSampleL  = outSample;  // fixed biquad filtering ultrasonics
 
     inputSampleL *= inputlevelL;
@@ -380,7 +406,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleIl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothIl + inputSampleL);
     _smoothIl       = inputSampleL;
@@ -392,16 +418,16 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleJl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothJl + inputSampleL);
     _smoothJl       = inputSampleL;
     inputSampleL    = bridgerectifier;
     // two-sample averaging lowpass
 
-    outSample     = (inputSampleL * _fixF[FixA0]) + _fixF[FixSL1];
-    _fixF[FixSL1] = (inputSampleL * _fixF[FixA1]) - (outSample * _fixF[FixB1]) + _fixF[FixSL2];
-    _fixF[FixSL2] = (inputSampleL * _fixF[FixA2]) - (outSample * _fixF[FixB2]);
+    outSample     = (inputSampleL * _fixF[FixA0]) + _fixStateF[FixSL1];
+    _fixStateF[FixSL1] = (inputSampleL * _fixF[FixA1]) - (outSample * _fixF[FixB1]) + _fixStateF[FixSL2];
+    _fixStateF[FixSL2] = (inputSampleL * _fixF[FixA2]) - (outSample * _fixF[FixB2]);
     inputSampleL  = outSample;  // fixed biquad filtering ultrasonics
 
     inputSampleL *= inputlevelL;
@@ -410,7 +436,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleKl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothKl + inputSampleL);
     _smoothKl       = inputSampleL;
@@ -422,7 +448,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     basscutL *= _bassfactor;
     inputSampleL = inputSampleL - (_iirSampleLl * basscutL);
     // highpass
-    inputSampleL -= (inputSampleL * (etl::abs(inputSampleL) * Float(0.654)) * (etl::abs(inputSampleL) * Float(0.654)));
+    inputSampleL -= (inputSampleL * (laneAbs(inputSampleL) * Float(0.654)) * (laneAbs(inputSampleL) * Float(0.654)));
     // overdrive
     bridgerectifier = (_smoothLl + inputSampleL);
     _smoothLl       = inputSampleL;
@@ -441,7 +467,7 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     if (_count < 0 || _count > 128) {
         _count = 128;
     }
-    auto resultBL = 0.0;
+    auto resultBL = Sample{};
     if (_flip) {
         _oddL[_count + 128] = _oddL[_count] = _iirSpkAl;
         resultBL = (_oddL[_count + _down] + _oddL[_count + _side] + _oddL[_count + _diagonal]);
@@ -455,21 +481,8 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     // extra lowpass for 4*12" speakers
     // extra lowpass for 4*12" speakers
 
-    bridgerectifier = etl::abs(inputSampleL * _outputlevel);
-    if (bridgerectifier > Float(1.57079633)) {
-        bridgerectifier = Float(1.57079633);
-    }
-    bridgerectifier = sineLUT(bridgerectifier);
-    if (inputSampleL > 0) {
-        inputSampleL = bridgerectifier;
-    } else {
-        inputSampleL = -bridgerectifier;
-    }
-
-    if (bridgerectifier > Float(1.57079633)) {
-        bridgerectifier = Float(1.57079633);
-    }
-    bridgerectifier = sineLUT(bridgerectifier);
+    bridgerectifier = sineClip(laneAbs(inputSampleL * _outputlevel));
+    inputSampleL    = withPolarity(inputSampleL, bridgerectifier);
 
     _iirSubL = (_iirSubL * (Float(1) - _beq)) + (inputSampleL * _beq);
     inputSampleL += (_iirSubL * _bassfill * _outputlevel);
@@ -579,90 +592,90 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
         _bL[2]  = _bL[1];
         _bL[1]  = _bL[0];
         _bL[0]  = inputSampleL;
-        inputSampleL += (_bL[1] * (Float(1.31698250313308396) - (Float(0.08140616497621633) * etl::abs(_bL[1]))));
-        inputSampleL += (_bL[2] * (Float(1.47229016949915326) - (Float(0.27680278993637253) * etl::abs(_bL[2]))));
-        inputSampleL += (_bL[3] * (Float(1.30410109086044956) - (Float(0.35629113432046489) * etl::abs(_bL[3]))));
-        inputSampleL += (_bL[4] * (Float(0.81766210474551260) - (Float(0.26808782337659753) * etl::abs(_bL[4]))));
-        inputSampleL += (_bL[5] * (Float(0.19868872545506663) - (Float(0.11105517193919669) * etl::abs(_bL[5]))));
-        inputSampleL -= (_bL[6] * (Float(0.39115909132567039) - (Float(0.12630622002682679) * etl::abs(_bL[6]))));
-        inputSampleL -= (_bL[7] * (Float(0.76881891559343574) - (Float(0.40879849500403143) * etl::abs(_bL[7]))));
-        inputSampleL -= (_bL[8] * (Float(0.87146861782680340) - (Float(0.59529560488000599) * etl::abs(_bL[8]))));
-        inputSampleL -= (_bL[9] * (Float(0.79504575932563670) - (Float(0.60877047551611796) * etl::abs(_bL[9]))));
-        inputSampleL -= (_bL[10] * (Float(0.61653017622406314) - (Float(0.47662851438557335) * etl::abs(_bL[10]))));
-        inputSampleL -= (_bL[11] * (Float(0.40718195794382067) - (Float(0.24955839378539713) * etl::abs(_bL[11]))));
-        inputSampleL -= (_bL[12] * (Float(0.31794900040616203) - (Float(0.04169792259600613) * etl::abs(_bL[12]))));
-        inputSampleL -= (_bL[13] * (Float(0.41075032540217843) + (Float(0.00368483996076280) * etl::abs(_bL[13]))));
-        inputSampleL -= (_bL[14] * (Float(0.56901352922170667) - (Float(0.11027360805893105) * etl::abs(_bL[14]))));
-        inputSampleL -= (_bL[15] * (Float(0.62443222391889264) - (Float(0.22198075154245228) * etl::abs(_bL[15]))));
-        inputSampleL -= (_bL[16] * (Float(0.53462856723129204) - (Float(0.22933544545324852) * etl::abs(_bL[16]))));
-        inputSampleL -= (_bL[17] * (Float(0.34441703361995046) - (Float(0.12956809502269492) * etl::abs(_bL[17]))));
-        inputSampleL -= (_bL[18] * (Float(0.13947052337867882) + (Float(0.00339775055962799) * etl::abs(_bL[18]))));
-        inputSampleL += (_bL[19] * (Float(0.03771252648928484) - (Float(0.10863931549251718) * etl::abs(_bL[19]))));
-        inputSampleL += (_bL[20] * (Float(0.18280210770271693) - (Float(0.17413646599296417) * etl::abs(_bL[20]))));
-        inputSampleL += (_bL[21] * (Float(0.24621986701761467) - (Float(0.14547053270435095) * etl::abs(_bL[21]))));
-        inputSampleL += (_bL[22] * (Float(0.22347075142737360) - (Float(0.02493869490104031) * etl::abs(_bL[22]))));
-        inputSampleL += (_bL[23] * (Float(0.14346348482123716) + (Float(0.11284054747963246) * etl::abs(_bL[23]))));
-        inputSampleL += (_bL[24] * (Float(0.00834364862916028) + (Float(0.24284684053733926) * etl::abs(_bL[24]))));
-        inputSampleL -= (_bL[25] * (Float(0.11559740296078347) - (Float(0.32623054435304538) * etl::abs(_bL[25]))));
-        inputSampleL -= (_bL[26] * (Float(0.18067604561283060) - (Float(0.32311481551122478) * etl::abs(_bL[26]))));
-        inputSampleL -= (_bL[27] * (Float(0.22927997789035612) - (Float(0.26991539052832925) * etl::abs(_bL[27]))));
-        inputSampleL -= (_bL[28] * (Float(0.28487666578669446) - (Float(0.22437227250279349) * etl::abs(_bL[28]))));
-        inputSampleL -= (_bL[29] * (Float(0.31992973037153838) - (Float(0.15289876100963865) * etl::abs(_bL[29]))));
-        inputSampleL -= (_bL[30] * (Float(0.35174606303520733) - (Float(0.05656293023086628) * etl::abs(_bL[30]))));
-        inputSampleL -= (_bL[31] * (Float(0.36894898011375254) + (Float(0.04333925421463558) * etl::abs(_bL[31]))));
-        inputSampleL -= (_bL[32] * (Float(0.32567576055307507) + (Float(0.14594589410921388) * etl::abs(_bL[32]))));
-        inputSampleL -= (_bL[33] * (Float(0.27440135050585784) + (Float(0.15529667398122521) * etl::abs(_bL[33]))));
-        inputSampleL -= (_bL[34] * (Float(0.21998973785078091) + (Float(0.05083553737157104) * etl::abs(_bL[34]))));
-        inputSampleL -= (_bL[35] * (Float(0.10323624876862457) - (Float(0.04651829594199963) * etl::abs(_bL[35]))));
-        inputSampleL += (_bL[36] * (Float(0.02091603687851074) + (Float(0.12000046818439322) * etl::abs(_bL[36]))));
-        inputSampleL += (_bL[37] * (Float(0.11344930914138468) + (Float(0.17697142512225839) * etl::abs(_bL[37]))));
-        inputSampleL += (_bL[38] * (Float(0.22766779627643968) + (Float(0.13645102964003858) * etl::abs(_bL[38]))));
-        inputSampleL += (_bL[39] * (Float(0.38378309953638229) - (Float(0.01997653307333791) * etl::abs(_bL[39]))));
-        inputSampleL += (_bL[40] * (Float(0.52789400804568076) - (Float(0.21409137428422448) * etl::abs(_bL[40]))));
-        inputSampleL += (_bL[41] * (Float(0.55444630296938280) - (Float(0.32331980931576626) * etl::abs(_bL[41]))));
-        inputSampleL += (_bL[42] * (Float(0.42333237669264601) - (Float(0.26855847463044280) * etl::abs(_bL[42]))));
-        inputSampleL += (_bL[43] * (Float(0.21942831522035078) - (Float(0.12051365248820624) * etl::abs(_bL[43]))));
-        inputSampleL -= (_bL[44] * (Float(0.00584169427830633) - (Float(0.03706970171280329) * etl::abs(_bL[44]))));
-        inputSampleL -= (_bL[45] * (Float(0.24279799124660351) - (Float(0.17296440491477982) * etl::abs(_bL[45]))));
-        inputSampleL -= (_bL[46] * (Float(0.40173760787507085) - (Float(0.21717989835163351) * etl::abs(_bL[46]))));
-        inputSampleL -= (_bL[47] * (Float(0.43930035724188155) - (Float(0.16425928481378199) * etl::abs(_bL[47]))));
-        inputSampleL -= (_bL[48] * (Float(0.41067765934041811) - (Float(0.10390115786636855) * etl::abs(_bL[48]))));
-        inputSampleL -= (_bL[49] * (Float(0.34409235547165967) - (Float(0.07268159377411920) * etl::abs(_bL[49]))));
-        inputSampleL -= (_bL[50] * (Float(0.26542883122568151) - (Float(0.05483457497365785) * etl::abs(_bL[50]))));
-        inputSampleL -= (_bL[51] * (Float(0.22024754776138800) - (Float(0.06484897950087598) * etl::abs(_bL[51]))));
-        inputSampleL -= (_bL[52] * (Float(0.20394367993632415) - (Float(0.08746309731952180) * etl::abs(_bL[52]))));
-        inputSampleL -= (_bL[53] * (Float(0.17565242431124092) - (Float(0.07611309538078760) * etl::abs(_bL[53]))));
-        inputSampleL -= (_bL[54] * (Float(0.10116623231246825) - (Float(0.00642818706295112) * etl::abs(_bL[54]))));
-        inputSampleL -= (_bL[55] * (Float(0.00782648272053632) + (Float(0.08004141267685004) * etl::abs(_bL[55]))));
-        inputSampleL += (_bL[56] * (Float(0.05059046006747323) - (Float(0.12436676387548490) * etl::abs(_bL[56]))));
-        inputSampleL += (_bL[57] * (Float(0.06241531553254467) - (Float(0.11530779547021434) * etl::abs(_bL[57]))));
-        inputSampleL += (_bL[58] * (Float(0.04952694587101836) - (Float(0.08340945324333944) * etl::abs(_bL[58]))));
-        inputSampleL += (_bL[59] * (Float(0.00843873294401687) - (Float(0.03279659052562903) * etl::abs(_bL[59]))));
-        inputSampleL -= (_bL[60] * (Float(0.05161338949440241) - (Float(0.03428181149163798) * etl::abs(_bL[60]))));
-        inputSampleL -= (_bL[61] * (Float(0.08165520146902012) - (Float(0.08196746092283110) * etl::abs(_bL[61]))));
-        inputSampleL -= (_bL[62] * (Float(0.06639532849935320) - (Float(0.09797462781896329) * etl::abs(_bL[62]))));
-        inputSampleL -= (_bL[63] * (Float(0.02953430910661621) - (Float(0.09175612938515763) * etl::abs(_bL[63]))));
-        inputSampleL += (_bL[64] * (Float(0.00741058547442938) + (Float(0.05442091048731967) * etl::abs(_bL[64]))));
-        inputSampleL += (_bL[65] * (Float(0.01832866125391727) + (Float(0.00306243693643687) * etl::abs(_bL[65]))));
-        inputSampleL += (_bL[66] * (Float(0.00526964230373573) - (Float(0.04364102661136410) * etl::abs(_bL[66]))));
-        inputSampleL -= (_bL[67] * (Float(0.00300984373848200) + (Float(0.09742737841278880) * etl::abs(_bL[67]))));
-        inputSampleL -= (_bL[68] * (Float(0.00413616769576694) + (Float(0.14380661694523073) * etl::abs(_bL[68]))));
-        inputSampleL -= (_bL[69] * (Float(0.00588769034931419) + (Float(0.16012843578892538) * etl::abs(_bL[69]))));
-        inputSampleL -= (_bL[70] * (Float(0.00688588239450581) + (Float(0.14074464279305798) * etl::abs(_bL[70]))));
-        inputSampleL -= (_bL[71] * (Float(0.02277307992926315) + (Float(0.07914752191801366) * etl::abs(_bL[71]))));
-        inputSampleL -= (_bL[72] * (Float(0.04627166091180877) - (Float(0.00192787268067208) * etl::abs(_bL[72]))));
-        inputSampleL -= (_bL[73] * (Float(0.05562045897455786) - (Float(0.05932868727665747) * etl::abs(_bL[73]))));
-        inputSampleL -= (_bL[74] * (Float(0.05134243784922165) - (Float(0.08245334798868090) * etl::abs(_bL[74]))));
-        inputSampleL -= (_bL[75] * (Float(0.04719409472239919) - (Float(0.07498680629253825) * etl::abs(_bL[75]))));
-        inputSampleL -= (_bL[76] * (Float(0.05889738914266415) - (Float(0.06116127018043697) * etl::abs(_bL[76]))));
-        inputSampleL -= (_bL[77] * (Float(0.09428363535111127) - (Float(0.06535868867863834) * etl::abs(_bL[77]))));
-        inputSampleL -= (_bL[78] * (Float(0.15181756953225126) - (Float(0.08982979655234427) * etl::abs(_bL[78]))));
-        inputSampleL -= (_bL[79] * (Float(0.20878969456036670) - (Float(0.10761070891499538) * etl::abs(_bL[79]))));
-        inputSampleL -= (_bL[80] * (Float(0.22647885581813790) - (Float(0.08462542510349125) * etl::abs(_bL[80]))));
-        inputSampleL -= (_bL[81] * (Float(0.19723482443646323) - (Float(0.02665160920736287) * etl::abs(_bL[81]))));
-        inputSampleL -= (_bL[82] * (Float(0.16441643451155163) + (Float(0.02314691954338197) * etl::abs(_bL[82]))));
-        inputSampleL -= (_bL[83] * (Float(0.15201914054931515) + (Float(0.04424903493886839) * etl::abs(_bL[83]))));
-        inputSampleL -= (_bL[84] * (Float(0.15454370641307855) + (Float(0.04223203797913008) * etl::abs(_bL[84]))));
+        inputSampleL += (_bL[1] * (Float(1.31698250313308396) - (Float(0.08140616497621633) * laneAbs(_bL[1]))));
+        inputSampleL += (_bL[2] * (Float(1.47229016949915326) - (Float(0.27680278993637253) * laneAbs(_bL[2]))));
+        inputSampleL += (_bL[3] * (Float(1.30410109086044956) - (Float(0.35629113432046489) * laneAbs(_bL[3]))));
+        inputSampleL += (_bL[4] * (Float(0.81766210474551260) - (Float(0.26808782337659753) * laneAbs(_bL[4]))));
+        inputSampleL += (_bL[5] * (Float(0.19868872545506663) - (Float(0.11105517193919669) * laneAbs(_bL[5]))));
+        inputSampleL -= (_bL[6] * (Float(0.39115909132567039) - (Float(0.12630622002682679) * laneAbs(_bL[6]))));
+        inputSampleL -= (_bL[7] * (Float(0.76881891559343574) - (Float(0.40879849500403143) * laneAbs(_bL[7]))));
+        inputSampleL -= (_bL[8] * (Float(0.87146861782680340) - (Float(0.59529560488000599) * laneAbs(_bL[8]))));
+        inputSampleL -= (_bL[9] * (Float(0.79504575932563670) - (Float(0.60877047551611796) * laneAbs(_bL[9]))));
+        inputSampleL -= (_bL[10] * (Float(0.61653017622406314) - (Float(0.47662851438557335) * laneAbs(_bL[10]))));
+        inputSampleL -= (_bL[11] * (Float(0.40718195794382067) - (Float(0.24955839378539713) * laneAbs(_bL[11]))));
+        inputSampleL -= (_bL[12] * (Float(0.31794900040616203) - (Float(0.04169792259600613) * laneAbs(_bL[12]))));
+        inputSampleL -= (_bL[13] * (Float(0.41075032540217843) + (Float(0.00368483996076280) * laneAbs(_bL[13]))));
+        inputSampleL -= (_bL[14] * (Float(0.56901352922170667) - (Float(0.11027360805893105) * laneAbs(_bL[14]))));
+        inputSampleL -= (_bL[15] * (Float(0.62443222391889264) - (Float(0.22198075154245228) * laneAbs(_bL[15]))));
+        inputSampleL -= (_bL[16] * (Float(0.53462856723129204) - (Float(0.22933544545324852) * laneAbs(_bL[16]))));
+        inputSampleL -= (_bL[17] * (Float(0.34441703361995046) - (Float(0.12956809502269492) * laneAbs(_bL[17]))));
+        inputSampleL -= (_bL[18] * (Float(0.13947052337867882) + (Float(0.00339775055962799) * laneAbs(_bL[18]))));
+        inputSampleL += (_bL[19] * (Float(0.03771252648928484) - (Float(0.10863931549251718) * laneAbs(_bL[19]))));
+        inputSampleL += (_bL[20] * (Float(0.18280210770271693) - (Float(0.17413646599296417) * laneAbs(_bL[20]))));
+        inputSampleL += (_bL[21] * (Float(0.24621986701761467) - (Float(0.14547053270435095) * laneAbs(_bL[21]))));
+        inputSampleL += (_bL[22] * (Float(0.22347075142737360) - (Float(0.02493869490104031) * laneAbs(_bL[22]))));
+        inputSampleL += (_bL[23] * (Float(0.14346348482123716) + (Float(0.11284054747963246) * laneAbs(_bL[23]))));
+        inputSampleL += (_bL[24] * (Float(0.00834364862916028) + (Float(0.24284684053733926) * laneAbs(_bL[24]))));
+        inputSampleL -= (_bL[25] * (Float(0.11559740296078347) - (Float(0.32623054435304538) * laneAbs(_bL[25]))));
+        inputSampleL -= (_bL[26] * (Float(0.18067604561283060) - (Float(0.32311481551122478) * laneAbs(_bL[26]))));
+        inputSampleL -= (_bL[27] * (Float(0.22927997789035612) - (Float(0.26991539052832925) * laneAbs(_bL[27]))));
+        inputSampleL -= (_bL[28] * (Float(0.28487666578669446) - (Float(0.22437227250279349) * laneAbs(_bL[28]))));
+        inputSampleL -= (_bL[29] * (Float(0.31992973037153838) - (Float(0.15289876100963865) * laneAbs(_bL[29]))));
+        inputSampleL -= (_bL[30] * (Float(0.35174606303520733) - (Float(0.05656293023086628) * laneAbs(_bL[30]))));
+        inputSampleL -= (_bL[31] * (Float(0.36894898011375254) + (Float(0.04333925421463558) * laneAbs(_bL[31]))));
+        inputSampleL -= (_bL[32] * (Float(0.32567576055307507) + (Float(0.14594589410921388) * laneAbs(_bL[32]))));
+        inputSampleL -= (_bL[33] * (Float(0.27440135050585784) + (Float(0.15529667398122521) * laneAbs(_bL[33]))));
+        inputSampleL -= (_bL[34] * (Float(0.21998973785078091) + (Float(0.05083553737157104) * laneAbs(_bL[34]))));
+        inputSampleL -= (_bL[35] * (Float(0.10323624876862457) - (Float(0.04651829594199963) * laneAbs(_bL[35]))));
+        inputSampleL += (_bL[36] * (Float(0.02091603687851074) + (Float(0.12000046818439322) * laneAbs(_bL[36]))));
+        inputSampleL += (_bL[37] * (Float(0.11344930914138468) + (Float(0.17697142512225839) * laneAbs(_bL[37]))));
+        inputSampleL += (_bL[38] * (Float(0.22766779627643968) + (Float(0.13645102964003858) * laneAbs(_bL[38]))));
+        inputSampleL += (_bL[39] * (Float(0.38378309953638229) - (Float(0.01997653307333791) * laneAbs(_bL[39]))));
+        inputSampleL += (_bL[40] * (Float(0.52789400804568076) - (Float(0.21409137428422448) * laneAbs(_bL[40]))));
+        inputSampleL += (_bL[41] * (Float(0.55444630296938280) - (Float(0.32331980931576626) * laneAbs(_bL[41]))));
+        inputSampleL += (_bL[42] * (Float(0.42333237669264601) - (Float(0.26855847463044280) * laneAbs(_bL[42]))));
+        inputSampleL += (_bL[43] * (Float(0.21942831522035078) - (Float(0.12051365248820624) * laneAbs(_bL[43]))));
+        inputSampleL -= (_bL[44] * (Float(0.00584169427830633) - (Float(0.03706970171280329) * laneAbs(_bL[44]))));
+        inputSampleL -= (_bL[45] * (Float(0.24279799124660351) - (Float(0.17296440491477982) * laneAbs(_bL[45]))));
+        inputSampleL -= (_bL[46] * (Float(0.40173760787507085) - (Float(0.21717989835163351) * laneAbs(_bL[46]))));
+        inputSampleL -= (_bL[47] * (Float(0.43930035724188155) - (Float(0.16425928481378199) * laneAbs(_bL[47]))));
+        inputSampleL -= (_bL[48] * (Float(0.41067765934041811) - (Float(0.10390115786636855) * laneAbs(_bL[48]))));
+        inputSampleL -= (_bL[49] * (Float(0.34409235547165967) - (Float(0.07268159377411920) * laneAbs(_bL[49]))));
+        inputSampleL -= (_bL[50] * (Float(0.26542883122568151) - (Float(0.05483457497365785) * laneAbs(_bL[50]))));
+        inputSampleL -= (_bL[51] * (Float(0.22024754776138800) - (Float(0.06484897950087598) * laneAbs(_bL[51]))));
+        inputSampleL -= (_bL[52] * (Float(0.20394367993632415) - (Float(0.08746309731952180) * laneAbs(_bL[52]))));
+        inputSampleL -= (_bL[53] * (Float(0.17565242431124092) - (Float(0.07611309538078760) * laneAbs(_bL[53]))));
+        inputSampleL -= (_bL[54] * (Float(0.10116623231246825) - (Float(0.00642818706295112) * laneAbs(_bL[54]))));
+        inputSampleL -= (_bL[55] * (Float(0.00782648272053632) + (Float(0.08004141267685004) * laneAbs(_bL[55]))));
+        inputSampleL += (_bL[56] * (Float(0.05059046006747323) - (Float(0.12436676387548490) * laneAbs(_bL[56]))));
+        inputSampleL += (_bL[57] * (Float(0.06241531553254467) - (Float(0.11530779547021434) * laneAbs(_bL[57]))));
+        inputSampleL += (_bL[58] * (Float(0.04952694587101836) - (Float(0.08340945324333944) * laneAbs(_bL[58]))));
+        inputSampleL += (_bL[59] * (Float(0.00843873294401687) - (Float(0.03279659052562903) * laneAbs(_bL[59]))));
+        inputSampleL -= (_bL[60] * (Float(0.05161338949440241) - (Float(0.03428181149163798) * laneAbs(_bL[60]))));
+        inputSampleL -= (_bL[61] * (Float(0.08165520146902012) - (Float(0.08196746092283110) * laneAbs(_bL[61]))));
+        inputSampleL -= (_bL[62] * (Float(0.06639532849935320) - (Float(0.09797462781896329) * laneAbs(_bL[62]))));
+        inputSampleL -= (_bL[63] * (Float(0.02953430910661621) - (Float(0.09175612938515763) * laneAbs(_bL[63]))));
+        inputSampleL += (_bL[64] * (Float(0.00741058547442938) + (Float(0.05442091048731967) * laneAbs(_bL[64]))));
+        inputSampleL += (_bL[65] * (Float(0.01832866125391727) + (Float(0.00306243693643687) * laneAbs(_bL[65]))));
+        inputSampleL += (_bL[66] * (Float(0.00526964230373573) - (Float(0.04364102661136410) * laneAbs(_bL[66]))));
+        inputSampleL -= (_bL[67] * (Float(0.00300984373848200) + (Float(0.09742737841278880) * laneAbs(_bL[67]))));
+        inputSampleL -= (_bL[68] * (Float(0.00413616769576694) + (Float(0.14380661694523073) * laneAbs(_bL[68]))));
+        inputSampleL -= (_bL[69] * (Float(0.00588769034931419) + (Float(0.16012843578892538) * laneAbs(_bL[69]))));
+        inputSampleL -= (_bL[70] * (Float(0.00688588239450581) + (Float(0.14074464279305798) * laneAbs(_bL[70]))));
+        inputSampleL -= (_bL[71] * (Float(0.02277307992926315) + (Float(0.07914752191801366) * laneAbs(_bL[71]))));
+        inputSampleL -= (_bL[72] * (Float(0.04627166091180877) - (Float(0.00192787268067208) * laneAbs(_bL[72]))));
+        inputSampleL -= (_bL[73] * (Float(0.05562045897455786) - (Float(0.05932868727665747) * laneAbs(_bL[73]))));
+        inputSampleL -= (_bL[74] * (Float(0.05134243784922165) - (Float(0.08245334798868090) * laneAbs(_bL[74]))));
+        inputSampleL -= (_bL[75] * (Float(0.04719409472239919) - (Float(0.07498680629253825) * laneAbs(_bL[75]))));
+        inputSampleL -= (_bL[76] * (Float(0.05889738914266415) - (Float(0.06116127018043697) * laneAbs(_bL[76]))));
+        inputSampleL -= (_bL[77] * (Float(0.09428363535111127) - (Float(0.06535868867863834) * laneAbs(_bL[77]))));
+        inputSampleL -= (_bL[78] * (Float(0.15181756953225126) - (Float(0.08982979655234427) * laneAbs(_bL[78]))));
+        inputSampleL -= (_bL[79] * (Float(0.20878969456036670) - (Float(0.10761070891499538) * laneAbs(_bL[79]))));
+        inputSampleL -= (_bL[80] * (Float(0.22647885581813790) - (Float(0.08462542510349125) * laneAbs(_bL[80]))));
+        inputSampleL -= (_bL[81] * (Float(0.19723482443646323) - (Float(0.02665160920736287) * laneAbs(_bL[81]))));
+        inputSampleL -= (_bL[82] * (Float(0.16441643451155163) + (Float(0.02314691954338197) * laneAbs(_bL[82]))));
+        inputSampleL -= (_bL[83] * (Float(0.15201914054931515) + (Float(0.04424903493886839) * laneAbs(_bL[83]))));
+        inputSampleL -= (_bL[84] * (Float(0.15454370641307855) + (Float(0.04223203797913008) * laneAbs(_bL[84]))));
 
         temp         = (inputSampleL + _smoothCabBl) * (Float(1) / Float(3));
         _smoothCabBl = inputSampleL;
@@ -706,17 +719,17 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     {
         case 4:
             _lastRefL[8] = inputSampleL;
-            inputSampleL = (inputSampleL + _lastRefL[7]) * 0.5;
+            inputSampleL = (inputSampleL + _lastRefL[7]) * Float(0.5);
             _lastRefL[7] = _lastRefL[8];  // continue, do not break
             [[fallthrough]];
         case 3:
             _lastRefL[8] = inputSampleL;
-            inputSampleL = (inputSampleL + _lastRefL[6]) * 0.5;
+            inputSampleL = (inputSampleL + _lastRefL[6]) * Float(0.5);
             _lastRefL[6] = _lastRefL[8];  // continue, do not break
             [[fallthrough]];
         case 2:
             _lastRefL[8] = inputSampleL;
-            inputSampleL = (inputSampleL + _lastRefL[5]) * 0.5;
+            inputSampleL = (inputSampleL + _lastRefL[5]) * Float(0.5);
             _lastRefL[5] = _lastRefL[8];  // continue, do not break
         case 1: break;                    // no further averaging
     }
@@ -724,57 +737,57 @@ auto AirWindowsFireAmp<Float, URNG>::operator()(Float const x) -> Float
     return inputSampleL;
 }
 
-template<etl::floating_point Float, typename URNG>
-auto AirWindowsFireAmp<Float, URNG>::reset() -> void
+template<Lane Sample, typename URNG>
+auto AirWindowsFireAmp<Sample, URNG>::reset() -> void
 {
-    _lastSampleL  = 0.0;
-    _storeSampleL = 0.0;
-    _smoothAl     = 0.0;
-    _smoothBl     = 0.0;
-    _smoothCl     = 0.0;
-    _smoothDl     = 0.0;
-    _smoothEl     = 0.0;
-    _smoothFl     = 0.0;
-    _smoothGl     = 0.0;
-    _smoothHl     = 0.0;
-    _smoothIl     = 0.0;
-    _smoothJl     = 0.0;
-    _smoothKl     = 0.0;
-    _smoothLl     = 0.0;
-    _iirSampleAl  = 0.0;
-    _iirSampleBl  = 0.0;
-    _iirSampleCl  = 0.0;
-    _iirSampleDl  = 0.0;
-    _iirSampleEl  = 0.0;
-    _iirSampleFl  = 0.0;
-    _iirSampleGl  = 0.0;
-    _iirSampleHl  = 0.0;
-    _iirSampleIl  = 0.0;
-    _iirSampleJl  = 0.0;
-    _iirSampleKl  = 0.0;
-    _iirSampleLl  = 0.0;
-    _iirLowpassL  = 0.0;
-    _iirSpkAl     = 0.0;
-    _iirSpkBl     = 0.0;
-    _iirSubL      = 0.0;
+    _lastSampleL  = Sample{};
+    _storeSampleL = Sample{};
+    _smoothAl     = Sample{};
+    _smoothBl     = Sample{};
+    _smoothCl     = Sample{};
+    _smoothDl     = Sample{};
+    _smoothEl     = Sample{};
+    _smoothFl     = Sample{};
+    _smoothGl     = Sample{};
+    _smoothHl     = Sample{};
+    _smoothIl     = Sample{};
+    _smoothJl     = Sample{};
+    _smoothKl     = Sample{};
+    _smoothLl     = Sample{};
+    _iirSampleAl  = Sample{};
+    _iirSampleBl  = Sample{};
+    _iirSampleCl  = Sample{};
+    _iirSampleDl  = Sample{};
+    _iirSampleEl  = Sample{};
+    _iirSampleFl  = Sample{};
+    _iirSampleGl  = Sample{};
+    _iirSampleHl  = Sample{};
+    _iirSampleIl  = Sample{};
+    _iirSampleJl  = Sample{};
+    _iirSampleKl  = Sample{};
+    _iirSampleLl  = Sample{};
+    _iirLowpassL  = Sample{};
+    _iirSpkAl     = Sample{};
+    _iirSpkBl     = Sample{};
+    _iirSubL      = Sample{};
 
     for (int fcount = 0; fcount < 257; fcount++) {
-        _oddL[fcount]  = 0.0;
-        _evenL[fcount] = 0.0;
+        _oddL[fcount]  = Sample{};
+        _evenL[fcount] = Sample{};
     }
 
     _count = 0;
     _flip  = false;  // amp
 
     for (auto& fcount : _bL) {
-        fcount = 0;
+        fcount = Sample{};
     }
-    _smoothCabAl    = 0.0;
-    _smoothCabBl    = 0.0;
-    _lastCabSampleL = 0.0;  // cab
+    _smoothCabAl    = Sample{};
+    _smoothCabBl    = Sample{};
+    _lastCabSampleL = Sample{};  // cab
 
     for (int fcount = 0; fcount < 9; fcount++) {
-        _lastRefL[fcount] = 0.0;
+        _lastRefL[fcount] = Sample{};
     }
     _cycle = 0;  // undersampling
 
@@ -785,6 +798,14 @@ auto AirWindowsFireAmp<Float, URNG>::reset() -> void
         _fixD[x] = 0.0;
         _fixE[x] = 0.0;
         _fixF[x] = 0.0;
+    }
+    for (int x = 0; x < FixStateTotal; x++) {
+        _fixStateA[x] = Sample{};
+        _fixStateB[x] = Sample{};
+        _fixStateC[x] = Sample{};
+        _fixStateD[x] = Sample{};
+        _fixStateE[x] = Sample{};
+        _fixStateF[x] = Sample{};
     }  // filtering
 }
 
@@ -92,3 +92,56 @@ TEMPLATE_TEST_CASE("audio/airwindows: AirWindowsVinylDither", "", float, double)
 
     test<grit::AirWindowsVinylDither<Float>>(Float(44'100));
 }
+
+/// Both lanes of a stereo amp are bit-exact to two mono amps with the same seed.
+template<template<typename, typename> typename Amp, typename Float>
+auto requireBitExactLanes(Float sampleRate) -> void
+{
+    using Frame = grit::StereoFrame<Float>;
+    using Mono  = Amp<Float, etl::xoshiro128plusplus>;
+
+    CAPTURE(sampleRate);
+
+    auto rng    = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto param  = etl::uniform_real_distribution<Float>{Float(0), Float(1)};
+    auto signal = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto const seed = rng();
+    auto stereo     = Amp<Frame, etl::xoshiro128plusplus>{seed};
+    auto left       = Mono{seed};
+    auto right      = Mono{seed};
+
+    auto const gain   = param(rng);
+    auto const tone   = param(rng);
+    auto const output = param(rng);
+    auto const mix    = param(rng);
+    stereo.setSampleRate(sampleRate);
+    left.setSampleRate(sampleRate);
+    right.setSampleRate(sampleRate);
+    stereo.setParameter({gain, tone, output, mix});
+    left.setParameter({gain, tone, output, mix});
+    right.setParameter({gain, tone, output, mix});
+
+    for (auto i{0}; i < 4096; ++i) {
+        auto const x = Frame{signal(rng), signal(rng)};
+        auto const y = stereo(x);
+        REQUIRE(y.left == left(x.left));
+        REQUIRE(y.right == right(x.right));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/airwindows: AirWindowsFireAmp<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+
+    auto const sampleRate = GENERATE(Float(44100), Float(96000));
+    requireBitExactLanes<grit::AirWindowsFireAmp>(sampleRate);
+}
+
+TEMPLATE_TEST_CASE("audio/airwindows: AirWindowsGrindAmp<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+
+    auto const sampleRate = GENERATE(Float(44100), Float(96000));
+    requireBitExactLanes<grit::AirWindowsGrindAmp>(sampleRate);
+}
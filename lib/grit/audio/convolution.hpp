@@ -0,0 +1,6 @@
+#pragma once
+
+/// \defgroup grit-audio-convolution Convolution
+/// \ingroup grit-audio
+
+#include <grit/audio/convolution/partitioned_convolver.hpp>
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <grit/fft/static_real_plan.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit {
+
+/// \brief Uniformly partitioned overlap-save convolution.
+///
+/// \details The impulse response is split into partitions of BlockSize taps,
+/// each transformed once with a 2*BlockSize point real FFT. Every block the
+/// input spectrum is pushed into a frequency-domain delay line and multiplied
+/// with all partition spectra, followed by a single inverse transform. The cost
+/// per block is one forward FFT, one inverse FFT and one complex
+/// multiply-accumulate per bin and partition, independent of the input. There
+/// is no latency beyond the audio block itself.
+///
+/// \ingroup grit-audio-convolution
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+struct PartitionedConvolver
+{
+    static_assert(etl::has_single_bit(BlockSize) and BlockSize >= 2);
+    static_assert(MaxPartitions > 0);
+
+    using SampleType = Float;
+
+    PartitionedConvolver() = default;
+
+    [[nodiscard]] static constexpr auto blockSize() -> etl::size_t { return BlockSize; }
+
+    [[nodiscard]] static constexpr auto maxPartitions() -> etl::size_t { return MaxPartitions; }
+
+    [[nodiscard]] static constexpr auto maxImpulseLength() -> etl::size_t { return BlockSize * MaxPartitions; }
+
+    [[nodiscard]] auto numPartitions() const -> etl::size_t { return _numPartitions; }
+
+    /// Impulse responses longer than maxImpulseLength() are truncated. Resets the convolution state.
+    template<etl::linalg::in_vector Vec>
+    auto setImpulseResponse(Vec ir) -> void;
+
+    auto reset() -> void;
+
+    /// Processes exactly BlockSize samples. Input and output may alias.
+    template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec>
+    auto operator()(InVec input, OutVec output) -> void;
+
+private:
+    using Complex = etl::complex<Float>;
+
+    static constexpr auto fftSize = BlockSize * 2;
+    static constexpr auto numBins = BlockSize + 1;
+
+    using Samples  = etl::mdspan<Float, etl::extents<etl::size_t, fftSize>>;
+    using Spectrum = etl::mdspan<Complex, etl::extents<etl::size_t, numBins>>;
+
+    [[nodiscard]] static auto partition(etl::array<Complex, numBins * MaxPartitions>& buf, etl::size_t p) -> Spectrum
+    {
+        return Spectrum{&buf[p * numBins]};
+    }
+
+    fft::StaticRealPlan<Float, fftSize> _fft{};
+
+    etl::size_t _numPartitions{0};
+    etl::size_t _head{0};
+
+    etl::array<Float, fftSize> _input{};
+    etl::array<Float, fftSize> _output{};
+    etl::array<Complex, numBins> _accumulator{};
+    etl::array<Complex, numBins * MaxPartitions> _filter{};
+    etl::array<Complex, numBins * MaxPartitions> _delayLine{};
+};
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+template<etl::linalg::in_vector Vec>
+auto PartitionedConvolver<Float, BlockSize, MaxPartitions>::setImpulseResponse(Vec ir) -> void
+{
+    auto const length = etl::min(static_cast<etl::size_t>(ir.extent(0)), maxImpulseLength());
+    _numPartitions    = (length + BlockSize - 1) / BlockSize;
+
+    auto const time = Samples{_input.data()};
+    for (auto p{0U}; p < MaxPartitions; ++p) {
+        etl::fill(_input.begin(), _input.end(), Float(0));
+        for (auto i{0U}; i < BlockSize; ++i) {
+            auto const n = p * BlockSize + i;
+            if (n < length) {
+                time(i) = static_cast<Float>(ir(n));
+            }
+        }
+
+        // Fold the 1/N normalization of the inverse transform into the filter
+        auto const h = partition(_filter, p);
+        _fft(time, h);
+        etl::linalg::scale(Float(1) / Float(fftSize), h);
+    }
+
+    reset();
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+auto PartitionedConvolver<Float, BlockSize, MaxPartitions>::reset() -> void
+{
+    _head = 0;
+    etl::fill(_input.begin(), _input.end(), Float(0));
+    etl::fill(_output.begin(), _output.end(), Float(0));
+    etl::fill(_delayLine.begin(), _delayLine.end(), Complex{});
+}
+
+template<etl::floating_point Float, etl::size_t BlockSize, etl::size_t MaxPartitions>
+template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec>
+auto PartitionedConvolver<Float, BlockSize, MaxPartitions>::operator()(InVec input, OutVec output) -> void
+{
+    if (_numPartitions == 0) {
+        for (auto i{0U}; i < BlockSize; ++i) {
+            output(i) = Float(0);
+        }
+        return;
+    }
+
+    // Slide the 2*BlockSize input window: [previous block, current block]
+    etl::copy(_input.begin() + BlockSize, _input.end(), _input.begin());
+    for (auto i{0U}; i < BlockSize; ++i) {
+        _input[BlockSize + i] = input(i);
+    }
+
+    _fft(Samples{_input.data()}, partition(_delayLine, _head));
+
+    etl::fill(_accumulator.begin(), _accumulator.end(), Complex{});
+    auto slot = _head;
+    for (auto p{0U}; p < _numPartitions; ++p) {
+        auto const x = partition(_delayLine, slot);
+        auto const h = partition(_filter, p);
+        for (auto k{0U}; k < numBins; ++k) {
+            _accumulator[k] = _accumulator[k] + x(k) * h(k);
+        }
+        slot = slot == 0 ? _numPartitions - 1 : slot - 1;
+    }
+
+    _fft(Spectrum{_accumulator.data()}, Samples{_output.data()});
+    _head = _head + 1 == _numPartitions ? 0 : _head + 1;
+
+    // Overlap-save: Only the second half is free of circular aliasing
+    for (auto i{0U}; i < BlockSize; ++i) {
+        output(i) = _output[BlockSize + i];
+    }
+}
+
+}  // namespace grit
@@ -0,0 +1,78 @@
+#include "partitioned_convolver.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEMPLATE_TEST_CASE("audio/convolution: PartitionedConvolver", "", float, double)
+{
+    using Float = TestType;
+
+    static constexpr auto blockSize  = 32U;
+    static constexpr auto numBlocks  = 24U;
+    static constexpr auto signalSize = blockSize * numBlocks;
+
+    auto const irLength  = GENERATE(1U, 7U, 32U, 33U, 300U, 512U, 600U);
+    auto const tolerance = sizeof(Float) == 4 ? 1e-4 : 1e-10;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto ir = etl::array<Float, 600>{};
+    etl::generate(ir.begin(), etl::next(ir.begin(), irLength), [&] { return dist(rng) * Float(0.1); });
+
+    auto signal = etl::array<Float, signalSize>{};
+    etl::generate(signal.begin(), signal.end(), [&] { return dist(rng); });
+
+    auto expected = etl::array<Float, signalSize>{};
+    for (auto n{0U}; n < signalSize; ++n) {
+        for (auto k{0U}; k < irLength and k <= n; ++k) {
+            expected[n] += ir[k] * signal[n - k];
+        }
+    }
+
+    auto convolver = grit::PartitionedConvolver<Float, blockSize, 16>{};
+    STATIC_REQUIRE(convolver.maxImpulseLength() == 512);
+    REQUIRE(convolver.numPartitions() == 0);
+
+    convolver.setImpulseResponse(etl::mdspan{ir.data(), etl::extents{irLength}});
+    auto const truncated = etl::min<etl::size_t>(irLength, convolver.maxImpulseLength());
+    REQUIRE(convolver.numPartitions() == (truncated + blockSize - 1) / blockSize);
+
+    if (irLength > convolver.maxImpulseLength()) {
+        for (auto n{0U}; n < signalSize; ++n) {
+            expected[n] = Float(0);
+            for (auto k{0U}; k < truncated and k <= n; ++k) {
+                expected[n] += ir[k] * signal[n - k];
+            }
+        }
+    }
+
+    for (auto b{0U}; b < numBlocks; ++b) {
+        auto block = etl::mdspan{etl::next(signal.data(), b * blockSize), etl::extents{blockSize}};
+        convolver(block, block);
+    }
+
+    for (auto n{0U}; n < signalSize; ++n) {
+        REQUIRE_THAT(signal[n], Catch::Matchers::WithinAbs(expected[n], tolerance));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/convolution: PartitionedConvolver without impulse response", "", float, double)
+{
+    using Float = TestType;
+
+    auto buffer = etl::array<Float, 16>{};
+    etl::fill(buffer.begin(), buffer.end(), Float(1));
+
+    auto convolver = grit::PartitionedConvolver<Float, 16, 4>{};
+    auto block     = etl::mdspan{buffer.data(), etl::extents{buffer.size()}};
+    convolver(block, block);
+
+    for (auto sample : buffer) {
+        REQUIRE(sample == Float(0));
+    }
+}
@@ -0,0 +1,57 @@
+#include "compressor.hpp"
+
+#include <grit/audio/processor/process_test.hpp>
+
+#include <etl/array.hpp>
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/dynamic: Compressor::process",
+    "",
+    (grit::HardKneeCompressor, grit::SoftKneeCompressor),
+    (float, double)
+)
+{
+    using Compressor = TestType;
+    using Float      = decltype(etl::declval<Compressor&>()(0.0F));
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto input     = etl::array<Float, 256>{};
+    auto sidechain = etl::array<Float, 256>{};
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        input[i]     = dist(rng);
+        sidechain[i] = dist(rng) * Float(2);
+    }
+
+    auto processor = Compressor{};
+    processor.setSampleRate(Float(48'000));
+    processor.setParameter({
+        .threshold = grit::Decibels<Float>{Float(-12)},
+        .knee      = grit::Decibels<Float>{Float(6)},
+        .ratio     = Float(4),
+        .attack    = grit::Milliseconds<Float>{Float(1)},
+        .release   = grit::Milliseconds<Float>{Float(20)},
+    });
+
+    grit::testing::requireBitExactBlocks(processor, input);
+
+    // Keyed by the sidechain, the state is carried over between blocks as well
+    auto keyed       = processor;
+    auto keyedRef    = processor;
+    auto keyedOutput = etl::array<Float, 256>{};
+    grit::testing::forEachUnevenBlock(input.size(), [&](etl::size_t offset, etl::size_t size) {
+        auto const in  = etl::span<Float const>{input}.subspan(offset, size);
+        auto const key = etl::span<Float const>{sidechain}.subspan(offset, size);
+        keyed.process(in, key, etl::span{keyedOutput}.subspan(offset, size));
+    });
+
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE(keyedOutput[i] == keyedRef(input[i], sidechain[i]));
+    }
+}
@@ -3,6 +3,8 @@
 #include <grit/unit/decibel.hpp>
 #include <grit/unit/time.hpp>
 
+#include <etl/span.hpp>
+
 namespace grit {
 
 /// \ingroup grit-audio-dynamic
@@ -42,6 +44,20 @@ struct Dynamic
         return x * fromDecibels(makeUpGain - yl);
     }
 
+    /// Processes input into output, both of the same size.
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void { process(input, input, output); }
+
+    /// Processes input keyed by sidechain into output, all of the same size.
+    auto process(etl::span<Float const> input, etl::span<Float const> sidechain, etl::span<Float> output) -> void
+    {
+        for (auto i = etl::size_t(0); i < output.size(); ++i) {
+            output[i] = (*this)(input[i], sidechain[i]);
+        }
+    }
+
+    /// Processes the buffer in-place.
+    auto process(etl::span<Float> buffer) -> void { process(etl::span<Float const>{buffer}, buffer); }
+
 private:
     TETL_NO_UNIQUE_ADDRESS LevelDetector _levelDetector;
     TETL_NO_UNIQUE_ADDRESS GainComputer _gainComputer;
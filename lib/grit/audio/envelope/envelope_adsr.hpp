@@ -57,6 +57,10 @@ private:
 
     static constexpr auto calcCoef(Float rate, Float targetRatio) -> Float
     {
+        // Zero length segment, the limit of the formula below without dividing by zero
+        if (rate <= Float(0)) {
+            return Float(0);
+        }
         return etl::exp(-etl::log((Float(1) + targetRatio) / targetRatio) / rate);
     }
 
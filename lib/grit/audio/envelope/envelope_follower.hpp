@@ -1,17 +1,24 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/unit/time.hpp>
 
 #include <etl/algorithm.hpp>
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
+/// \brief Peak envelope with separate attack & release times.
+/// \details On a StereoFrame each lane picks its own coefficient.
 /// \ingroup grit-audio-envelope
-template<etl::floating_point Float>
+template<Lane Sample>
 struct EnvelopeFollower
 {
+    using SampleType = Sample;
+    using Float      = LaneValue<Sample>;
+
     struct Parameter
     {
         Milliseconds<Float> attack{50};
@@ -24,59 +31,103 @@ struct EnvelopeFollower
 
     auto reset() -> void;
     auto setSampleRate(Float sampleRate) -> void;
-    [[nodiscard]] auto operator()(Float in) -> Float;
+    [[nodiscard]] auto operator()(Sample in) -> Sample;
+
+    /// Envelope of input into output, both of the same size.
+    auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void;
+
+    /// Replaces the buffer with its envelope.
+    auto process(etl::span<Sample> buffer) -> void;
 
 private:
+    struct Coefficients
+    {
+        Float attack;
+        Float release;
+    };
+
     auto update() -> void;
+    [[nodiscard]] static auto tick(Sample in, Sample envelope, Coefficients const& coefficients) -> Sample;
 
     Parameter _parameter{};
     Float _sampleRate{};
-    Float _attackCoef{};
-    Float _releaseCoef{};
-    Float _envelope{};
+    Coefficients _coefficients{};
+    Sample _envelope{};
 };
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::setParameter(Parameter const& parameter) -> void
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::setParameter(Parameter const& parameter) -> void
 {
     _parameter = parameter;
     update();
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::setSampleRate(Float sampleRate) -> void
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::setSampleRate(Float sampleRate) -> void
 {
     _sampleRate = sampleRate;
     update();
     reset();
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::operator()(Float in) -> Float
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::operator()(Sample in) -> Sample
 {
-    auto const env  = etl::abs(in);
-    auto const coef = env > _envelope ? _attackCoef : _releaseCoef;
-
-    _envelope = coef * (_envelope - env) + env;
+    _envelope = tick(in, _envelope, _coefficients);
     return _envelope;
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::reset() -> void
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::process(etl::span<Sample const> input, etl::span<Sample> output) -> void
+{
+    // Local coefficients & state, stores to output can't alias them
+    auto const coefficients = _coefficients;
+    auto envelope           = _envelope;
+    for (auto i = etl::size_t(0); i < output.size(); ++i) {
+        envelope  = tick(input[i], envelope, coefficients);
+        output[i] = envelope;
+    }
+    _envelope = envelope;
+}
+
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::process(etl::span<Sample> buffer) -> void
+{
+    process(etl::span<Sample const>{buffer}, buffer);
+}
+
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::tick(Sample in, Sample envelope, Coefficients const& coefficients) -> Sample
+{
+    auto const attack  = coefficients.attack;
+    auto const release = coefficients.release;
+    return lanewise(
+        [attack, release](Float x, Float previous) {
+            auto const env  = etl::abs(x);
+            auto const coef = env > previous ? attack : release;
+            return coef * (previous - env) + env;
+        },
+        in,
+        envelope
+    );
+}
+
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::reset() -> void
 {
-    _envelope = Float(0);
+    _envelope = Sample{};
 }
 
-template<etl::floating_point Float>
-auto EnvelopeFollower<Float>::update() -> void
+template<Lane Sample>
+auto EnvelopeFollower<Sample>::update() -> void
 {
     static constexpr auto const log001 = etl::log(Float(0.01));
 
     auto const attack  = _parameter.attack.count();
     auto const release = _parameter.release.count();
 
-    _attackCoef  = etl::exp(log001 / (attack * _sampleRate * Float(0.001)));
-    _releaseCoef = etl::exp(log001 / (release * _sampleRate * Float(0.001)));
+    _coefficients.attack  = etl::exp(log001 / (attack * _sampleRate * Float(0.001)));
+    _coefficients.release = etl::exp(log001 / (release * _sampleRate * Float(0.001)));
 }
 
 }  // namespace grit
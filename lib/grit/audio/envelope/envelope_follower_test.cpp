@@ -1,6 +1,12 @@
 #include "envelope_follower.hpp"
 
+#include <grit/audio/processor/process_test.hpp>
+
+#include <etl/array.hpp>
+#include <etl/random.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 
 TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower", "", float, double)
@@ -44,3 +50,53 @@ TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower", "", float, double)
     REQUIRE(y3 < Float(0.25));
     REQUIRE(y3 > Float(y1));
 }
+
+TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower::process", "", float, double)
+{
+    using Float = TestType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    // Bursts, so both the attack & release branch are taken
+    auto input = etl::array<Float, 256>{};
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        input[i] = (i / 32U) % 2U == 0 ? dist(rng) : dist(rng) * Float(0.01);
+    }
+
+    auto processor = grit::EnvelopeFollower<Float>{};
+    processor.setSampleRate(Float(48'000));
+    processor.setParameter({.attack = grit::Milliseconds<Float>{1}, .release = grit::Milliseconds<Float>{20}});
+
+    grit::testing::requireBitExactBlocks(processor, input);
+}
+
+TEMPLATE_TEST_CASE("audio/envelope: EnvelopeFollower<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto stereo = grit::EnvelopeFollower<Frame>{};
+    auto left   = grit::EnvelopeFollower<Float>{};
+    auto right  = grit::EnvelopeFollower<Float>{};
+    for (auto* follower : {&left, &right}) {
+        follower->setSampleRate(Float(48'000));
+        follower->setParameter({grit::Milliseconds<Float>{2}, grit::Milliseconds<Float>{20}});
+    }
+    stereo.setSampleRate(Float(48'000));
+    stereo.setParameter({grit::Milliseconds<Float>{2}, grit::Milliseconds<Float>{20}});
+
+    // Bursts with different timing per channel, so the lanes take different branches
+    for (auto i = 0; i < 512; ++i) {
+        auto const x = Frame{
+            (i / 32) % 2 == 0 ? dist(rng) : Float(0),
+            (i / 48) % 2 == 0 ? dist(rng) : Float(0),
+        };
+        auto const y = stereo(x);
+        REQUIRE(y.left == left(x.left));
+        REQUIRE(y.right == right(x.right));
+    }
+}
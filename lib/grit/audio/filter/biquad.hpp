@@ -1,5 +1,7 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
+
 #include <etl/algorithm.hpp>
 #include <etl/array.hpp>
 #include <etl/cmath.hpp>
@@ -41,10 +43,11 @@ struct BiquadCoefficients
 
 /// \brief 2nd order IIR filter using the transpose direct form 2 structure.
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
+template<Lane Sample>
 struct Biquad
 {
-    using SampleType   = Float;
+    using SampleType   = Sample;
+    using Float        = LaneValue<Sample>;
     using Coefficients = BiquadCoefficients<Float>;
 
     constexpr Biquad() = default;
@@ -52,12 +55,23 @@ struct Biquad
     constexpr auto setCoefficients(etl::span<Float const, 6> coefficients) -> void;
     constexpr auto reset() -> void;
 
-    [[nodiscard]] constexpr auto operator()(Float x) -> Float;
+    [[nodiscard]] constexpr auto operator()(Sample x) -> Sample;
+
+    /// Filters input into output, both of the same size.
+    constexpr auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void;
+
+    /// Filters the buffer in-place.
+    constexpr auto process(etl::span<Sample> buffer) -> void;
 
 private:
     using Index = Coefficients::Index;
-    etl::array<Float, Index::NumCoefficients> _coefficients{Coefficients::makeBypass()};
-    etl::array<Float, 2> _z{};
+    using Array = etl::array<Float, Index::NumCoefficients>;
+    using State = etl::array<Sample, 2>;
+
+    [[nodiscard]] static constexpr auto tick(Sample x, Array const& coefficients, State& z) -> Sample;
+
+    Array _coefficients{Coefficients::makeBypass()};
+    State _z{};
 };
 
 template<etl::floating_point Float>
@@ -108,31 +122,55 @@ constexpr auto BiquadCoefficients<Float>::makeHighPass(Float cutoff, Float Q, Fl
     return {b0, b1, b2, a0, a1, a2};
 }
 
-template<etl::floating_point Float>
-constexpr auto Biquad<Float>::setCoefficients(etl::span<Float const, 6> coefficients) -> void
+template<Lane Sample>
+constexpr auto Biquad<Sample>::setCoefficients(etl::span<Float const, 6> coefficients) -> void
 {
     etl::copy(coefficients.begin(), coefficients.end(), _coefficients.begin());
 }
 
-template<etl::floating_point Float>
-constexpr auto Biquad<Float>::reset() -> void
+template<Lane Sample>
+constexpr auto Biquad<Sample>::reset() -> void
 {
-    _z[0] = Float(0);
-    _z[1] = Float(0);
+    _z[0] = Sample{};
+    _z[1] = Sample{};
 }
 
-template<etl::floating_point Float>
-constexpr auto Biquad<Float>::operator()(Float x) -> Float
+template<Lane Sample>
+constexpr auto Biquad<Sample>::operator()(Sample x) -> Sample
+{
+    return tick(x, _coefficients, _z);
+}
+
+template<Lane Sample>
+constexpr auto Biquad<Sample>::process(etl::span<Sample const> input, etl::span<Sample> output) -> void
+{
+    // Local coefficients & state, stores to output can't alias them
+    auto const coefficients = _coefficients;
+    auto z                  = _z;
+    for (auto i = etl::size_t(0); i < output.size(); ++i) {
+        output[i] = tick(input[i], coefficients, z);
+    }
+    _z = z;
+}
+
+template<Lane Sample>
+constexpr auto Biquad<Sample>::process(etl::span<Sample> buffer) -> void
+{
+    process(etl::span<Sample const>{buffer}, buffer);
+}
+
+template<Lane Sample>
+constexpr auto Biquad<Sample>::tick(Sample x, Array const& coefficients, State& z) -> Sample
 {
-    auto const b0 = _coefficients[Index::B0];
-    auto const b1 = _coefficients[Index::B1];
-    auto const b2 = _coefficients[Index::B2];
-    auto const a1 = _coefficients[Index::A1];
-    auto const a2 = _coefficients[Index::A2];
-
-    auto const y = b0 * x + _z[0];
-    _z[0]        = b1 * x - a1 * y + _z[1];
-    _z[1]        = b2 * x - a2 * y;
+    auto const b0 = coefficients[Index::B0];
+    auto const b1 = coefficients[Index::B1];
+    auto const b2 = coefficients[Index::B2];
+    auto const a1 = coefficients[Index::A1];
+    auto const a2 = coefficients[Index::A2];
+
+    auto const y = b0 * x + z[0];
+    z[0]         = b1 * x - a1 * y + z[1];
+    z[1]         = b2 * x - a2 * y;
     return y;
 }
 
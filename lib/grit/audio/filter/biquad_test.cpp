@@ -1,5 +1,7 @@
 #include "biquad.hpp"
 
+#include <grit/audio/processor/process_test.hpp>
+
 #include <etl/random.hpp>
 
 #include <catch2/catch_get_random_seed.hpp>
@@ -86,3 +88,48 @@ TEMPLATE_TEST_CASE("audio/filter: Biquad", "", float, double)
         }
     }
 }
+
+TEMPLATE_TEST_CASE("audio/filter: Biquad::process", "", float, double)
+{
+    using Float  = TestType;
+    using Filter = grit::Biquad<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto input = etl::array<Float, 256>{};
+    for (auto& x : input) {
+        x = dist(rng);
+    }
+
+    auto processor = Filter{};
+    processor.setCoefficients(Filter::Coefficients::makeLowPass(Float(1'000), Float(0.71), Float(48'000)));
+
+    grit::testing::requireBitExactBlocks(processor, input);
+}
+
+TEMPLATE_TEST_CASE("audio/filter: Biquad<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto const coefficients = grit::BiquadCoefficients<Float>::makeHighPass(Float(500), Float(2), Float(48'000));
+
+    auto stereo = grit::Biquad<Frame>{};
+    auto left   = grit::Biquad<Float>{};
+    auto right  = grit::Biquad<Float>{};
+    stereo.setCoefficients(coefficients);
+    left.setCoefficients(coefficients);
+    right.setCoefficients(coefficients);
+
+    // Both lanes are bit-exact to a mono filter per channel
+    for (auto i = 0; i < 256; ++i) {
+        auto const x = Frame{dist(rng), dist(rng)};
+        auto const y = stereo(x);
+        REQUIRE(y.left == left(x.left));
+        REQUIRE(y.right == right(x.right));
+    }
+}
@@ -5,6 +5,7 @@
 #include <etl/concepts.hpp>
 #include <etl/numbers.hpp>
 #include <etl/numeric.hpp>
+#include <etl/span.hpp>
 #include <etl/type_traits.hpp>
 
 namespace grit {
@@ -21,41 +22,93 @@ struct DynamicSmoothing
     auto operator()(Float input) -> Float;
     auto reset() -> void;
 
+    /// Smooths input into output, both of the same size.
+    auto process(etl::span<Float const> input, etl::span<Float> output) -> void;
+
+    /// Smooths the buffer in-place.
+    auto process(etl::span<Float> buffer) -> void;
+
 private:
+    struct Coefficients
+    {
+        Float wc;
+        Float sensitivity;
+    };
+
+    struct State
+    {
+        Float low1;
+        Float low2;
+        Float inz;
+    };
+
+    [[nodiscard]] static auto tick(Float input, Coefficients const& coefficients, State& state) -> Float;
+
     Float _baseFrequency{2.0};
-    Float _sensitivity{0.5};
+    Coefficients _coefficients{.wc = Float(0), .sensitivity = Float(0.5)};
     Float _low1{};
     Float _low2{};
-    Float _wc{};
     Float _inz{};
 };
 
 template<etl::floating_point Float>
 auto DynamicSmoothing<Float>::setSampleRate(Float sampleRate) -> void
 {
-    auto const wc = _baseFrequency / sampleRate;
-    _wc           = wc;
+    _coefficients.wc = _baseFrequency / sampleRate;
 }
 
 template<etl::floating_point Float>
 auto DynamicSmoothing<Float>::operator()(Float input) -> Float
 {
-    auto const low1z = _low1;
-    auto const low2z = _low2;
+    auto state     = State{_low1, _low2, _inz};
+    auto const out = tick(input, _coefficients, state);
+
+    _low1 = state.low1;
+    _low2 = state.low2;
+    _inz  = state.inz;
+    return out;
+}
+
+template<etl::floating_point Float>
+auto DynamicSmoothing<Float>::process(etl::span<Float const> input, etl::span<Float> output) -> void
+{
+    // Local coefficients & state, stores to output can't alias them
+    auto const coefficients = _coefficients;
+    auto state              = State{_low1, _low2, _inz};
+    for (auto i = etl::size_t(0); i < output.size(); ++i) {
+        output[i] = tick(input[i], coefficients, state);
+    }
+
+    _low1 = state.low1;
+    _low2 = state.low2;
+    _inz  = state.inz;
+}
+
+template<etl::floating_point Float>
+auto DynamicSmoothing<Float>::process(etl::span<Float> buffer) -> void
+{
+    process(etl::span<Float const>{buffer}, buffer);
+}
+
+template<etl::floating_point Float>
+auto DynamicSmoothing<Float>::tick(Float input, Coefficients const& coefficients, State& state) -> Float
+{
+    auto const low1z = state.low1;
+    auto const low2z = state.low2;
     auto const bandz = low1z - low2z;
 
     auto const x1 = Float(5.9948827);
     auto const x2 = Float(-11.969296);
     auto const x3 = Float(15.959062);
 
-    auto const wd = _wc + _sensitivity * etl::abs(bandz);
+    auto const wd = coefficients.wc + coefficients.sensitivity * etl::abs(bandz);
     auto const g  = etl::min(wd * (x1 + wd * (x2 + wd * x3)), Float(1));
 
-    _low1 = low1z + g * (Float(0.5) * (input + _inz) - low1z);
-    _low2 = low2z + g * (Float(0.5) * (_low1 + low1z) - low2z);
-    _inz  = input;
+    state.low1 = low1z + g * (Float(0.5) * (input + state.inz) - low1z);
+    state.low2 = low2z + g * (Float(0.5) * (state.low1 + low1z) - low2z);
+    state.inz  = input;
 
-    return _low2;
+    return state.low2;
 }
 
 template<etl::floating_point Float>
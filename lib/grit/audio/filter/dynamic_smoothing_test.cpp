@@ -0,0 +1,30 @@
+#include "dynamic_smoothing.hpp"
+
+#include <grit/audio/processor/process_test.hpp>
+
+#include <etl/array.hpp>
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE("audio/filter: DynamicSmoothing::process", "", float, double)
+{
+    using Float = TestType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(0), Float(1)};
+
+    // Knob jumps every 64 samples
+    auto input = etl::array<Float, 256>{};
+    auto value = dist(rng);
+    for (auto i = etl::size_t(0); i < input.size(); ++i) {
+        value    = i % 64U == 0 ? dist(rng) : value;
+        input[i] = value;
+    }
+
+    auto processor = grit::DynamicSmoothing<Float>{};
+    processor.setSampleRate(Float(1'000));
+
+    grit::testing::requireBitExactBlocks(processor, input);
+}
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
+
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
 #include <etl/numbers.hpp>
+#include <etl/span.hpp>
 #include <etl/type_traits.hpp>
 
 namespace grit {
@@ -21,10 +24,11 @@ enum struct StateVariableFilterType
 /// \brief State variable filter
 /// \details https://cytomic.com/files/dsp/SvfLinearTrapAllOutputs.pdf
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float, StateVariableFilterType Type>
+template<Lane Sample, StateVariableFilterType Type>
 struct StateVariableFilter
 {
-    using SampleType = Float;
+    using SampleType = Sample;
+    using Float      = LaneValue<Sample>;
 
     struct Parameter
     {
@@ -36,75 +40,121 @@ struct StateVariableFilter
 
     auto setParameter(Parameter const& parameter) -> void;
     auto setSampleRate(Float sampleRate) -> void;
-    auto operator()(Float input) -> Float;
+    auto operator()(Sample input) -> Sample;
     auto reset() -> void;
 
+    /// Filters input into output, both of the same size.
+    auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void;
+
+    /// Filters the buffer in-place.
+    auto process(etl::span<Sample> buffer) -> void;
+
 private:
+    struct Coefficients
+    {
+        Float g;
+        Float k;
+        Float gt0;
+        Float gk0;
+    };
+
     auto update() -> void;
+    [[nodiscard]] static auto tick(Sample x, Coefficients const& coefficients, Sample& ic1eq, Sample& ic2eq) -> Sample;
 
     Parameter _parameter{};
     Float _sampleRate{0};
 
-    Float _g{0};
-    Float _k{0};
-    Float _gt0{0};
-    Float _gk0{0};
+    Coefficients _coefficients{};
 
-    Float _ic1eq{0};
-    Float _ic2eq{0};
+    Sample _ic1eq{};
+    Sample _ic2eq{};
 };
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableHighpass = StateVariableFilter<Float, StateVariableFilterType::Highpass>;
+template<Lane Sample>
+using StateVariableHighpass = StateVariableFilter<Sample, StateVariableFilterType::Highpass>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableBandpass = StateVariableFilter<Float, StateVariableFilterType::Bandpass>;
+template<Lane Sample>
+using StateVariableBandpass = StateVariableFilter<Sample, StateVariableFilterType::Bandpass>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableLowpass = StateVariableFilter<Float, StateVariableFilterType::Lowpass>;
+template<Lane Sample>
+using StateVariableLowpass = StateVariableFilter<Sample, StateVariableFilterType::Lowpass>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableNotch = StateVariableFilter<Float, StateVariableFilterType::Notch>;
+template<Lane Sample>
+using StateVariableNotch = StateVariableFilter<Sample, StateVariableFilterType::Notch>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariablePeak = StateVariableFilter<Float, StateVariableFilterType::Peak>;
+template<Lane Sample>
+using StateVariablePeak = StateVariableFilter<Sample, StateVariableFilterType::Peak>;
 
 /// \ingroup grit-audio-filter
-template<etl::floating_point Float>
-using StateVariableAllpass = StateVariableFilter<Float, StateVariableFilterType::Allpass>;
+template<Lane Sample>
+using StateVariableAllpass = StateVariableFilter<Sample, StateVariableFilterType::Allpass>;
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::setParameter(Parameter const& parameter) -> void
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::setParameter(Parameter const& parameter) -> void
 {
     _parameter = parameter;
     update();
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::setSampleRate(Float sampleRate) -> void
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::setSampleRate(Float sampleRate) -> void
 {
     _sampleRate = sampleRate;
     update();
     reset();
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::operator()(Float x) -> Float
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::operator()(Sample x) -> Sample
+{
+    return tick(x, _coefficients, _ic1eq, _ic2eq);
+}
+
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::process(etl::span<Sample const> input, etl::span<Sample> output) -> void
 {
-    auto const t0 = x - _ic2eq;
-    auto const v0 = _gt0 * t0 - _gk0 * _ic1eq;
-    auto const t1 = _g * v0;
-    auto const v1 = _ic1eq + t1;
-    auto const t2 = _g * v1;
-    auto const v2 = _ic2eq + t2;
+    // Local coefficients & state, stores to output can't alias them
+    auto const coefficients = _coefficients;
+    auto ic1eq              = _ic1eq;
+    auto ic2eq              = _ic2eq;
+    for (auto i = etl::size_t(0); i < output.size(); ++i) {
+        output[i] = tick(input[i], coefficients, ic1eq, ic2eq);
+    }
+
+    _ic1eq = ic1eq;
+    _ic2eq = ic2eq;
+}
+
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::process(etl::span<Sample> buffer) -> void
+{
+    process(etl::span<Sample const>{buffer}, buffer);
+}
+
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::tick(
+    Sample x,
+    Coefficients const& coefficients,
+    Sample& ic1eq,
+    Sample& ic2eq
+) -> Sample
+{
+    auto const [g, k, gt0, gk0] = coefficients;
+
+    auto const t0 = x - ic2eq;
+    auto const v0 = gt0 * t0 - gk0 * ic1eq;
+    auto const t1 = g * v0;
+    auto const v1 = ic1eq + t1;
+    auto const t2 = g * v1;
+    auto const v2 = ic2eq + t2;
 
-    _ic1eq = v1 + t1;
-    _ic2eq = v2 + t2;
+    ic1eq = v1 + t1;
+    ic2eq = v2 + t2;
 
     if constexpr (Type == StateVariableFilterType::Highpass) {
         return v0;
@@ -117,29 +167,30 @@ auto StateVariableFilter<Float, Type>::operator()(Float x) -> Float
     } else if constexpr (Type == StateVariableFilterType::Peak) {
         return v0 - v2;
     } else if constexpr (Type == StateVariableFilterType::Allpass) {
-        return v0 - _k * v1 + v2;
+        return v0 - k * v1 + v2;
     } else {
         static_assert(etl::always_false<decltype(Type)>);
     }
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::reset() -> void
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::reset() -> void
 {
-    _ic1eq = Float(0);
-    _ic2eq = Float(0);
+    _ic1eq = Sample{};
+    _ic2eq = Sample{};
 }
 
-template<etl::floating_point Float, StateVariableFilterType Type>
-auto StateVariableFilter<Float, Type>::update() -> void
+template<Lane Sample, StateVariableFilterType Type>
+auto StateVariableFilter<Sample, Type>::update() -> void
 {
     auto w = static_cast<Float>(etl::numbers::pi) * _parameter.cutoff / _sampleRate;
-    _g     = etl::tan(w);
-    _k     = 1 / _parameter.resonance;
+    auto g = etl::tan(w);
+    auto k = 1 / _parameter.resonance;
 
-    auto gk = _g + _k;
-    _gt0    = 1 / (1 + _g * gk);
-    _gk0    = gk * _gt0;
+    auto gk       = g + k;
+    auto gt0      = 1 / (1 + g * gk);
+    auto gk0      = gk * gt0;
+    _coefficients = Coefficients{.g = g, .k = k, .gt0 = gt0, .gk0 = gk0};
 }
 
 }  // namespace grit
@@ -1,5 +1,7 @@
 #include "state_variable_filter.hpp"
 
+#include <grit/audio/processor/process_test.hpp>
+
 #include <etl/random.hpp>
 
 #include <catch2/catch_get_random_seed.hpp>
@@ -43,3 +45,70 @@ TEMPLATE_PRODUCT_TEST_CASE(
         REQUIRE(etl::isfinite(y));
     }
 }
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/filter: StateVariableFilter::process",
+    "",
+    (grit::StateVariableHighpass,
+     grit::StateVariableBandpass,
+     grit::StateVariableLowpass,
+     grit::StateVariableNotch,
+     grit::StateVariablePeak,
+     grit::StateVariableAllpass),
+    (float, double)
+)
+{
+    using Filter = TestType;
+    using Float  = typename Filter::SampleType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto input = etl::array<Float, 256>{};
+    for (auto& x : input) {
+        x = dist(rng);
+    }
+
+    auto processor = Filter{};
+    processor.setSampleRate(Float(48'000));
+    processor.setParameter({.cutoff = Float(2'000), .resonance = Float(2)});
+
+    grit::testing::requireBitExactBlocks(processor, input);
+}
+
+/// Both lanes of a stereo filter are bit-exact to a mono filter per channel.
+template<template<typename> typename Filter, typename Float>
+auto requireBitExactLanes() -> void
+{
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(1)};
+
+    auto stereo = Filter<Frame>{};
+    auto left   = Filter<Float>{};
+    auto right  = Filter<Float>{};
+    stereo.setSampleRate(Float(48'000));
+    left.setSampleRate(Float(48'000));
+    right.setSampleRate(Float(48'000));
+    stereo.setParameter({.cutoff = Float(2'000), .resonance = Float(2)});
+    left.setParameter({.cutoff = Float(2'000), .resonance = Float(2)});
+    right.setParameter({.cutoff = Float(2'000), .resonance = Float(2)});
+
+    for (auto i = 0; i < 256; ++i) {
+        auto const x = Frame{dist(rng), dist(rng)};
+        auto const y = stereo(x);
+        REQUIRE(y.left == left(x.left));
+        REQUIRE(y.right == right(x.right));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/filter: StateVariableFilter<StereoFrame>", "", float, double)
+{
+    requireBitExactLanes<grit::StateVariableHighpass, TestType>();
+    requireBitExactLanes<grit::StateVariableBandpass, TestType>();
+    requireBitExactLanes<grit::StateVariableLowpass, TestType>();
+    requireBitExactLanes<grit::StateVariableNotch, TestType>();
+    requireBitExactLanes<grit::StateVariablePeak, TestType>();
+    requireBitExactLanes<grit::StateVariableAllpass, TestType>();
+}
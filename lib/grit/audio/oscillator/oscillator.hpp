@@ -5,6 +5,7 @@
 #include <etl/algorithm.hpp>
 #include <etl/concepts.hpp>
 #include <etl/numbers.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -31,7 +32,13 @@ struct Oscillator
 
     [[nodiscard]] auto operator()() -> Float;
 
+    /// Fills output with the next samples, the shape is selected once per block.
+    auto process(etl::span<Float> output) -> void;
+
 private:
+    template<typename Shape>
+    auto processShape(etl::span<Float> output, Shape shape) -> void;
+
     [[nodiscard]] static auto sine(Float phase) -> Float;
     [[nodiscard]] static auto triangle(Float phase) -> Float;
     [[nodiscard]] static auto pulse(Float phase, Float width) -> Float;
@@ -100,6 +107,44 @@ auto Oscillator<Float>::operator()() -> Float
     return output;
 }
 
+template<etl::floating_point Float>
+auto Oscillator<Float>::process(etl::span<Float> output) -> void
+{
+    switch (_shape) {
+        case OscillatorShape::Sine: {
+            processShape(output, [](Float phase) { return sine(phase); });
+            break;
+        }
+        case OscillatorShape::Triangle: {
+            processShape(output, [](Float phase) { return triangle(phase); });
+            break;
+        }
+        case OscillatorShape::Square: {
+            processShape(output, [width = _pulseWidth](Float phase) { return pulse(phase, width); });
+            break;
+        }
+        default: {
+            processShape(output, [](Float /*phase*/) { return Float{}; });
+            break;
+        }
+    }
+}
+
+template<etl::floating_point Float>
+template<typename Shape>
+auto Oscillator<Float>::processShape(etl::span<Float> output, Shape shape) -> void
+{
+    // Local state, stores to output can't alias it
+    auto const increment = _phaseIncrement;
+    auto phase           = _phase;
+    for (auto& sample : output) {
+        sample = shape(phase);
+        phase += increment;
+        phase -= etl::floor(phase);
+    }
+    _phase = phase;
+}
+
 template<etl::floating_point Float>
 auto Oscillator<Float>::sine(Float phase) -> Float
 {
@@ -0,0 +1,56 @@
+#include "oscillator.hpp"
+#include "variable_shape_oscillator.hpp"
+#include "wavetable_oscillator.hpp"
+
+#include <grit/audio/processor/process_test.hpp>
+
+#include <etl/array.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+TEMPLATE_TEST_CASE("audio/oscillator: Oscillator::process", "", float, double)
+{
+    using Float = TestType;
+
+    auto const shape = GENERATE(
+        grit::OscillatorShape::Sine,
+        grit::OscillatorShape::Triangle,
+        grit::OscillatorShape::Square
+    );
+
+    auto osc = grit::Oscillator<Float>{};
+    osc.setShape(shape);
+    osc.setSampleRate(Float(48'000));
+    osc.setFrequency(Float(1'234));
+    osc.setPhase(Float(0.25));
+
+    grit::testing::requireBitExactBlocks<Float>(osc);
+}
+
+TEMPLATE_TEST_CASE("audio/oscillator: VariableShapeOscillator::process", "", float, double)
+{
+    using Float = TestType;
+
+    auto osc = grit::VariableShapeOscillator<Float>{};
+    osc.setShapes(grit::OscillatorShape::Triangle, grit::OscillatorShape::Square);
+    osc.setShapeMorph(Float(0.3));
+    osc.setSampleRate(Float(48'000));
+    osc.setFrequency(Float(440));
+
+    grit::testing::requireBitExactBlocks<Float>(osc);
+}
+
+TEMPLATE_TEST_CASE("audio/oscillator: WavetableOscillator::process", "", float, double)
+{
+    using Float = TestType;
+
+    static constexpr auto sine = grit::makeSineWavetable<Float, 512>();
+    auto const table           = etl::mdspan{sine.data(), etl::extents<etl::size_t, 512>{}};
+
+    auto osc = grit::WavetableOscillator<Float, 512>{table};
+    osc.setSampleRate(Float(48'000));
+    osc.setFrequency(Float(3'000));
+
+    grit::testing::requireBitExactBlocks<Float>(osc);
+}
@@ -5,6 +5,7 @@
 #include <grit/math/remap.hpp>
 
 #include <etl/concepts.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -25,6 +26,9 @@ struct VariableShapeOscillator
 
     [[nodiscard]] auto operator()() -> Float;
 
+    /// Fills output with the next samples.
+    auto process(etl::span<Float> output) -> void;
+
 private:
     Oscillator<Float> _oscA{};
     Oscillator<Float> _oscB{};
@@ -41,7 +45,7 @@ auto VariableShapeOscillator<Float>::setShapes(OscillatorShape a, OscillatorShap
 template<etl::floating_point Float>
 auto VariableShapeOscillator<Float>::setShapeMorph(Float morph) -> void
 {
-    _crossFade.set_parameter({
+    _crossFade.setParameter({
         .mix   = etl::clamp(morph, Float{0}, Float{1}),
         .curve = CrossFadeCurve::ConstantPower,
     });
@@ -81,4 +85,14 @@ auto VariableShapeOscillator<Float>::operator()() -> Float
     return _crossFade(_oscA(), _oscB());
 }
 
+template<etl::floating_point Float>
+auto VariableShapeOscillator<Float>::process(etl::span<Float> output) -> void
+{
+    // Both oscillators are independent, A renders the whole block first
+    _oscA.process(output);
+    for (auto& sample : output) {
+        sample = _crossFade(sample, _oscB());
+    }
+}
+
 }  // namespace grit
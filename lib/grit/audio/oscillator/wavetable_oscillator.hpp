@@ -8,6 +8,7 @@
 #include <etl/concepts.hpp>
 #include <etl/mdspan.hpp>
 #include <etl/numbers.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
@@ -25,6 +26,9 @@ struct WavetableOscillator
 
     [[nodiscard]] auto operator()() -> Float;
 
+    /// Fills output with the next samples.
+    auto process(etl::span<Float> output) -> void;
+
 private:
     Float _sampleRate{0};
     Float _phase{0};
@@ -84,6 +88,31 @@ auto WavetableOscillator<Float, TableSize>::operator()() -> Float
     return BufferInterpolation::Hermite{}(_wavetable, sampleIndex, sampleOffset);
 }
 
+template<etl::floating_point Float, etl::size_t TableSize>
+auto WavetableOscillator<Float, TableSize>::process(etl::span<Float> output) -> void
+{
+    if (_wavetable.empty()) {
+        etl::fill(output.begin(), output.end(), Float(0));
+        return;
+    }
+
+    // Local state, stores to output can't alias it
+    auto const wavetable = _wavetable;
+    auto const size      = static_cast<Float>(wavetable.size());
+    auto const increment = _phaseIncrement;
+    auto phase           = _phase;
+    for (auto& sample : output) {
+        auto const scaledPhase  = phase * size;
+        auto const sampleIndex  = static_cast<etl::size_t>(scaledPhase);
+        auto const sampleOffset = scaledPhase - static_cast<Float>(sampleIndex);
+        phase += increment;
+        phase -= etl::floor(phase);
+
+        sample = BufferInterpolation::Hermite{}(wavetable, sampleIndex, sampleOffset);
+    }
+    _phase = phase;
+}
+
 template<typename Float, etl::size_t Size>
 constexpr auto makeSineWavetable() -> etl::array<Float, Size>
 {
@@ -0,0 +1,8 @@
+#pragma once
+
+/// \defgroup grit-audio-processor Processor
+/// \ingroup grit-audio
+
+#include <grit/audio/processor/chain.hpp>
+#include <grit/audio/processor/processor.hpp>
+#include <grit/audio/processor/tap.hpp>
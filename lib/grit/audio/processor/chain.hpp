@@ -0,0 +1,171 @@
+#pragma once
+
+#include <grit/audio/processor/processor.hpp>
+#include <grit/audio/stereo/lane.hpp>
+
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/span.hpp>
+#include <etl/utility.hpp>
+
+namespace grit {
+
+namespace detail {
+
+template<typename First, typename... Rest>
+struct ChainFront
+{
+    using type = First;
+};
+
+template<etl::size_t I, typename Stage>
+struct ChainStage
+{
+    constexpr ChainStage() = default;
+
+    explicit constexpr ChainStage(Stage s) : stage{s} {}
+
+    // Default-initialized, value-initializing an empty stage zeroes the stage
+    // it overlaps with on GCC 12
+    TETL_NO_UNIQUE_ADDRESS Stage stage;
+};
+
+template<typename Indices, typename... Stages>
+struct ChainStages;
+
+// Stateless stages like the WaveShaper take no space
+template<etl::size_t... Is, typename... Stages>
+struct ChainStages<etl::index_sequence<Is...>, Stages...> : ChainStage<Is, Stages>...
+{
+    constexpr ChainStages() = default;
+
+    explicit constexpr ChainStages(Stages... stages) : ChainStage<Is, Stages>{stages}... {}
+};
+
+template<etl::size_t I, typename Stage>
+[[nodiscard]] constexpr auto chainStage(ChainStage<I, Stage>& stage) -> Stage&
+{
+    return stage.stage;
+}
+
+template<etl::size_t I, typename Stage>
+[[nodiscard]] constexpr auto chainStage(ChainStage<I, Stage> const& stage) -> Stage const&
+{
+    return stage.stage;
+}
+
+}  // namespace detail
+
+/// \brief Processors in series, composed at compile-time.
+/// \details Each sample runs through all stages before the next one is read,
+/// so the block loop is fused into a single pass without intermediate buffers.
+/// Every call is visible to the compiler & inlined, the result is the same
+/// code as calling the stages by hand. Side outputs are read from a Tap stage,
+/// see its docs for block processing.
+/// \ingroup grit-audio-processor
+template<Processor... Stages>
+    requires(sizeof...(Stages) > 0)
+struct Chain
+{
+    using SampleType = typename detail::ChainFront<Stages...>::type::SampleType;
+    using Float      = LaneValue<SampleType>;
+
+    static_assert((etl::same_as<typename Stages::SampleType, SampleType> and ...));
+
+    constexpr Chain() = default;
+
+    explicit constexpr Chain(Stages... stages) : _stages{stages...} {}
+
+    /// Stage at index I, e.g. to set its parameters.
+    template<etl::size_t I>
+    [[nodiscard]] constexpr auto get() -> auto&
+    {
+        return detail::chainStage<I>(_stages);
+    }
+
+    template<etl::size_t I>
+    [[nodiscard]] constexpr auto get() const -> auto const&
+    {
+        return detail::chainStage<I>(_stages);
+    }
+
+    /// Forwarded to every stage with a sample rate.
+    constexpr auto setSampleRate(Float sampleRate) -> void;
+
+    constexpr auto reset() -> void;
+
+    [[nodiscard]] constexpr auto operator()(SampleType x) -> SampleType;
+
+    /// Runs input through all stages into output, both of the same size.
+    constexpr auto process(etl::span<SampleType const> input, etl::span<SampleType> output) -> void;
+
+    /// Runs the buffer through all stages in-place.
+    constexpr auto process(etl::span<SampleType> buffer) -> void;
+
+private:
+    using Indices    = etl::make_index_sequence<sizeof...(Stages)>;
+    using StageTuple = detail::ChainStages<Indices, Stages...>;
+
+    [[nodiscard]] static constexpr auto tick(SampleType x, StageTuple& stages) -> SampleType;
+
+    StageTuple _stages;
+};
+
+template<Processor... Stages>
+    requires(sizeof...(Stages) > 0)
+constexpr auto Chain<Stages...>::setSampleRate(Float sampleRate) -> void
+{
+    [this, sampleRate]<etl::size_t... Is>(etl::index_sequence<Is...> /*indices*/) {
+        auto prepare = [sampleRate](auto& stage) {
+            if constexpr (requires { stage.setSampleRate(sampleRate); }) {
+                stage.setSampleRate(sampleRate);
+            }
+        };
+        (prepare(get<Is>()), ...);
+    }(Indices{});
+}
+
+template<Processor... Stages>
+    requires(sizeof...(Stages) > 0)
+constexpr auto Chain<Stages...>::reset() -> void
+{
+    [this]<etl::size_t... Is>(etl::index_sequence<Is...> /*indices*/) { (get<Is>().reset(), ...); }(Indices{});
+}
+
+template<Processor... Stages>
+    requires(sizeof...(Stages) > 0)
+constexpr auto Chain<Stages...>::operator()(SampleType x) -> SampleType
+{
+    return tick(x, _stages);
+}
+
+template<Processor... Stages>
+    requires(sizeof...(Stages) > 0)
+constexpr auto Chain<Stages...>::process(etl::span<SampleType const> input, etl::span<SampleType> output) -> void
+{
+    // Local stages, stores to output can't alias their coefficients & state
+    auto stages = _stages;
+    for (auto i = etl::size_t(0); i < output.size(); ++i) {
+        output[i] = tick(input[i], stages);
+    }
+    _stages = stages;
+}
+
+template<Processor... Stages>
+    requires(sizeof...(Stages) > 0)
+constexpr auto Chain<Stages...>::process(etl::span<SampleType> buffer) -> void
+{
+    process(etl::span<SampleType const>{buffer}, buffer);
+}
+
+template<Processor... Stages>
+    requires(sizeof...(Stages) > 0)
+constexpr auto Chain<Stages...>::tick(SampleType x, StageTuple& stages) -> SampleType
+{
+    return [&stages]<etl::size_t... Is>(SampleType sample, etl::index_sequence<Is...> /*indices*/) {
+        ((sample = detail::chainStage<Is>(stages)(sample)), ...);
+        return sample;
+    }(x, Indices{});
+}
+
+}  // namespace grit
@@ -0,0 +1,157 @@
+#include "chain.hpp"
+#include "process_test.hpp"
+#include "tap.hpp"
+
+#include <grit/audio/envelope/envelope_follower.hpp>
+#include <grit/audio/filter/biquad.hpp>
+#include <grit/audio/filter/state_variable_filter.hpp>
+#include <grit/audio/stereo/stereo_frame.hpp>
+#include <grit/audio/waveshape/hard_clipper.hpp>
+#include <grit/audio/waveshape/tanh_clipper.hpp>
+
+#include <etl/array.hpp>
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE("audio/processor: Processor", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    STATIC_REQUIRE(grit::Processor<grit::Biquad<Float>>);
+    STATIC_REQUIRE(grit::Processor<grit::Biquad<Frame>>);
+    STATIC_REQUIRE(grit::Processor<grit::HardClipper<Float>>);
+    STATIC_REQUIRE(grit::Processor<grit::EnvelopeFollower<Float>>);
+    STATIC_REQUIRE(grit::Processor<grit::Tap<grit::EnvelopeFollower<Float>>>);
+    STATIC_REQUIRE(grit::Processor<grit::Chain<grit::Biquad<Float>, grit::HardClipper<Float>>>);
+    STATIC_REQUIRE_FALSE(grit::Processor<Float>);
+}
+
+TEMPLATE_TEST_CASE("audio/processor: Chain", "", float, double)
+{
+    using Float = TestType;
+    using Chain = grit::Chain<grit::StateVariableLowpass<Float>, grit::TanhClipperADAA1<Float>, grit::Biquad<Float>>;
+
+    // Stateless stages take no space
+    STATIC_REQUIRE(sizeof(grit::Chain<grit::Biquad<Float>, grit::HardClipper<Float>>) == sizeof(grit::Biquad<Float>));
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto const coefficients = grit::BiquadCoefficients<Float>::makeHighPass(Float(50), Float(0.71), Float(48'000));
+
+    auto chain = Chain{};
+    chain.setSampleRate(Float(48'000));
+    chain.template get<0>().setParameter({.cutoff = Float(2'000), .resonance = Float(2)});
+    chain.template get<2>().setCoefficients(coefficients);
+
+    auto filter  = grit::StateVariableLowpass<Float>{};
+    auto shaper  = grit::TanhClipperADAA1<Float>{};
+    auto dcBlock = grit::Biquad<Float>{};
+    filter.setSampleRate(Float(48'000));
+    filter.setParameter({.cutoff = Float(2'000), .resonance = Float(2)});
+    dcBlock.setCoefficients(coefficients);
+
+    // Bit-exact to calling the stages by hand
+    for (auto i = 0; i < 256; ++i) {
+        auto const x = dist(rng);
+        REQUIRE(chain(x) == dcBlock(shaper(filter(x))));
+    }
+
+    chain.reset();
+    filter.reset();
+    shaper.reset();
+    dcBlock.reset();
+    for (auto i = 0; i < 256; ++i) {
+        auto const x = dist(rng);
+        REQUIRE(chain(x) == dcBlock(shaper(filter(x))));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/processor: Chain::process", "", float, double)
+{
+    using Float = TestType;
+    using Chain = grit::Chain<grit::Biquad<Float>, grit::HardClipperADAA1<Float>>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto input = etl::array<Float, 256>{};
+    for (auto& x : input) {
+        x = dist(rng);
+    }
+
+    auto processor = Chain{};
+    processor.template get<0>().setCoefficients(
+        grit::BiquadCoefficients<Float>::makeLowPass(Float(1'000), Float(0.71), Float(48'000))
+    );
+
+    grit::testing::requireBitExactBlocks(processor, input);
+}
+
+TEMPLATE_TEST_CASE("audio/processor: Chain<StereoFrame>", "", float, double)
+{
+    using Float = TestType;
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto stereo = grit::Chain<grit::StateVariableLowpass<Frame>, grit::TanhClipperADAA1<Frame>>{};
+    auto left   = grit::Chain<grit::StateVariableLowpass<Float>, grit::TanhClipperADAA1<Float>>{};
+    auto right  = grit::Chain<grit::StateVariableLowpass<Float>, grit::TanhClipperADAA1<Float>>{};
+    stereo.setSampleRate(Float(48'000));
+    left.setSampleRate(Float(48'000));
+    right.setSampleRate(Float(48'000));
+
+    for (auto i = 0; i < 256; ++i) {
+        auto const x = Frame{dist(rng), dist(rng)};
+        auto const y = stereo(x);
+        REQUIRE(y.left == left(x.left));
+        REQUIRE(y.right == right(x.right));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/processor: Tap", "", float, double)
+{
+    using Float    = TestType;
+    using Envelope = grit::EnvelopeFollower<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto chain = grit::Chain<grit::Tap<Envelope>, grit::HardClipper<Float>, grit::Tap<Envelope>>{};
+    chain.setSampleRate(Float(48'000));
+
+    auto input  = Envelope{};
+    auto output = Envelope{};
+    input.setSampleRate(Float(48'000));
+    output.setSampleRate(Float(48'000));
+
+    // The taps pass the signal through, their value is the envelope at that point
+    for (auto i = 0; i < 256; ++i) {
+        auto const x = dist(rng);
+        auto const y = chain(x);
+        REQUIRE(y == grit::HardClipper<Float>{}(x));
+        REQUIRE(chain.template get<0>().value() == input(x));
+        REQUIRE(chain.template get<2>().value() == output(y));
+    }
+
+    // After a block only the side output of its last sample is kept
+    auto block = etl::array<Float, 32>{};
+    for (auto& x : block) {
+        x = dist(rng);
+    }
+    auto last = Float(0);
+    for (auto const x : block) {
+        last = input(x);
+    }
+    chain.process(etl::span{block});
+    REQUIRE(chain.template get<0>().value() == last);
+
+    chain.reset();
+    REQUIRE(chain.template get<0>().value() == Float(0));
+    REQUIRE(chain.template get<2>().value() == Float(0));
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+// Shared by the process(span) tests of the audio processors & generators.
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/span.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace grit::testing {
+
+/// Calls func(offset, size) for each block of [0, total). The block size grows
+/// 1, 3, 9, ... so blocks of one sample and ones crossing unrolled loops are covered.
+template<typename Func>
+auto forEachUnevenBlock(etl::size_t total, Func func) -> void
+{
+    for (auto offset = etl::size_t(0), size = etl::size_t(1); offset < total; offset += size, size *= 3) {
+        size = etl::min(size, total - offset);
+        func(offset, size);
+    }
+}
+
+/// Runs copies of the processor over uneven blocks, out-of-place & in-place, the
+/// state is carried over between blocks. Both have to match the per-sample operator.
+template<typename Processor, typename Float, etl::size_t Size>
+auto requireBitExactBlocks(Processor const& processor, etl::array<Float, Size> const& input) -> void
+{
+    auto reference = processor;
+    auto block     = processor;
+    auto inPlace   = processor;
+    auto output    = etl::array<Float, Size>{};
+    auto buffer    = input;
+    forEachUnevenBlock(Size, [&](etl::size_t offset, etl::size_t size) {
+        block.process(etl::span<Float const>{input}.subspan(offset, size), etl::span{output}.subspan(offset, size));
+        inPlace.process(etl::span{buffer}.subspan(offset, size));
+    });
+
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        CAPTURE(i);
+        auto const y = reference(input[i]);
+        REQUIRE(output[i] == y);
+        REQUIRE(buffer[i] == y);
+    }
+}
+
+/// Same for generators, the phase is carried over between blocks.
+template<typename Float, etl::size_t Size = 256, typename Generator>
+auto requireBitExactBlocks(Generator const& generator) -> void
+{
+    auto reference = generator;
+    auto block     = generator;
+    auto output    = etl::array<Float, Size>{};
+    forEachUnevenBlock(Size, [&](etl::size_t offset, etl::size_t size) {
+        block.process(etl::span{output}.subspan(offset, size));
+    });
+
+    for (auto i = etl::size_t(0); i < Size; ++i) {
+        CAPTURE(i);
+        REQUIRE(output[i] == reference());
+    }
+}
+
+}  // namespace grit::testing
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <grit/audio/stereo/lane.hpp>
+
+#include <etl/concepts.hpp>
+
+namespace grit {
+
+/// \brief Per-sample processor with a resettable state.
+/// \details The sample rate is optional, setSampleRate is only forwarded to
+/// processors that have one.
+/// \ingroup grit-audio-processor
+template<typename P>
+concept Processor = Lane<typename P::SampleType> and requires(P processor, typename P::SampleType x) {
+    processor.reset();
+    { processor(x) } -> etl::same_as<typename P::SampleType>;
+};
+
+}  // namespace grit
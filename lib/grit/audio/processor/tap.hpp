@@ -0,0 +1,54 @@
+#pragma once
+
+#include <grit/audio/processor/processor.hpp>
+#include <grit/audio/stereo/lane.hpp>
+
+namespace grit {
+
+/// \brief Side output of a Chain.
+/// \details Runs the processor on the signal & keeps its latest output, the
+/// signal itself passes through unchanged. E.g. Tap<EnvelopeFollower<float>>
+/// exposes the envelope at that point of the chain. Only one value is kept,
+/// after Chain::process(span) it belongs to the last sample of the block. Call
+/// the chain per sample if every side output value is needed.
+/// \ingroup grit-audio-processor
+template<Processor P>
+struct Tap
+{
+    using SampleType = typename P::SampleType;
+    using Float      = LaneValue<SampleType>;
+
+    constexpr Tap() = default;
+
+    explicit constexpr Tap(P processor) : _processor{processor} {}
+
+    constexpr auto setSampleRate(Float sampleRate) -> void
+        requires requires(P processor, Float rate) { processor.setSampleRate(rate); }
+    {
+        _processor.setSampleRate(sampleRate);
+    }
+
+    constexpr auto reset() -> void
+    {
+        _processor.reset();
+        _value = SampleType{};
+    }
+
+    [[nodiscard]] constexpr auto operator()(SampleType x) -> SampleType
+    {
+        _value = _processor(x);
+        return x;
+    }
+
+    /// Output of the processor for the latest sample.
+    [[nodiscard]] constexpr auto value() const -> SampleType { return _value; }
+
+    [[nodiscard]] constexpr auto processor() -> P& { return _processor; }
+    [[nodiscard]] constexpr auto processor() const -> P const& { return _processor; }
+
+private:
+    P _processor{};
+    SampleType _value{};
+};
+
+}  // namespace grit
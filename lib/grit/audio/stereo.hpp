@@ -3,6 +3,7 @@
 /// \defgroup grit-audio-stereo Stereo
 /// \ingroup grit-audio
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/audio/stereo/mid_side_frame.hpp>
 #include <grit/audio/stereo/stereo_block.hpp>
 #include <grit/audio/stereo/stereo_frame.hpp>
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <grit/audio/stereo/stereo_frame.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
+#include <etl/concepts.hpp>
+
+namespace grit {
+
+/// \brief Scalar type of the samples a processor runs on.
+/// \details Processors templated on a Lane run on a single floating-point
+/// sample or on a StereoFrame. For the latter both channels are processed as
+/// two lanes of one instance: Coefficients & control flow are shared, only the
+/// state is stored as L/R pairs.
+/// \ingroup grit-audio-stereo
+template<typename Sample>
+struct LaneTraits
+{};
+
+template<etl::floating_point Float>
+struct LaneTraits<Float>
+{
+    using ValueType = Float;
+};
+
+template<etl::floating_point Float>
+struct LaneTraits<StereoFrame<Float>>
+{
+    using ValueType = Float;
+};
+
+/// \ingroup grit-audio-stereo
+template<typename Sample>
+concept Lane = requires { typename LaneTraits<Sample>::ValueType; };
+
+/// \ingroup grit-audio-stereo
+template<Lane Sample>
+using LaneValue = typename LaneTraits<Sample>::ValueType;
+
+/// \brief Applies a scalar function to each lane.
+/// \ingroup grit-audio-stereo
+template<etl::floating_point Float, typename Func>
+[[nodiscard]] constexpr auto lanewise(Func const& func, Float x) -> Float
+{
+    return func(x);
+}
+
+/// \ingroup grit-audio-stereo
+template<etl::floating_point Float, typename Func>
+[[nodiscard]] constexpr auto lanewise(Func const& func, StereoFrame<Float> x) -> StereoFrame<Float>
+{
+    return {func(x.left), func(x.right)};
+}
+
+/// \brief Applies a scalar function to each pair of lanes.
+/// \ingroup grit-audio-stereo
+template<etl::floating_point Float, typename Func>
+[[nodiscard]] constexpr auto lanewise(Func const& func, Float x, Float y) -> Float
+{
+    return func(x, y);
+}
+
+/// \ingroup grit-audio-stereo
+template<etl::floating_point Float, typename Func>
+[[nodiscard]] constexpr auto lanewise(Func const& func, StereoFrame<Float> x, StereoFrame<Float> y)
+    -> StereoFrame<Float>
+{
+    return {func(x.left, y.left), func(x.right, y.right)};
+}
+
+/// \ingroup grit-audio-stereo
+template<Lane Sample>
+[[nodiscard]] constexpr auto laneAbs(Sample x) -> Sample
+{
+    return lanewise([](LaneValue<Sample> v) { return etl::abs(v); }, x);
+}
+
+/// \ingroup grit-audio-stereo
+template<Lane Sample>
+[[nodiscard]] constexpr auto laneClamp(Sample x, LaneValue<Sample> lo, LaneValue<Sample> hi) -> Sample
+{
+    return lanewise([lo, hi](LaneValue<Sample> v) { return etl::clamp(v, lo, hi); }, x);
+}
+
+}  // namespace grit
@@ -0,0 +1,55 @@
+#include "lane.hpp"
+
+#include <etl/concepts.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using namespace grit;
+
+TEMPLATE_TEST_CASE("audio/stereo: Lane", "[stereo]", float, double)
+{
+    using T = TestType;
+
+    STATIC_REQUIRE(Lane<T>);
+    STATIC_REQUIRE(Lane<StereoFrame<T>>);
+    STATIC_REQUIRE_FALSE(Lane<int>);
+    STATIC_REQUIRE_FALSE(Lane<StereoFrame<int>>);
+
+    STATIC_REQUIRE(etl::same_as<LaneValue<T>, T>);
+    STATIC_REQUIRE(etl::same_as<LaneValue<StereoFrame<T>>, T>);
+}
+
+TEMPLATE_TEST_CASE("audio/stereo: lanewise", "[stereo]", float, double)
+{
+    using T = TestType;
+
+    auto const twice = [](T x) { return x * T(2); };
+    REQUIRE(lanewise(twice, T(3)) == T(6));
+
+    auto const frame = lanewise(twice, StereoFrame<T>{T(1), T(-2)});
+    REQUIRE(frame.left == T(2));
+    REQUIRE(frame.right == T(-4));
+
+    auto const max = [](T x, T y) { return x < y ? y : x; };
+    REQUIRE(lanewise(max, T(1), T(2)) == T(2));
+
+    auto const pair = lanewise(max, StereoFrame<T>{T(1), T(4)}, StereoFrame<T>{T(2), T(3)});
+    REQUIRE(pair.left == T(2));
+    REQUIRE(pair.right == T(4));
+}
+
+TEMPLATE_TEST_CASE("audio/stereo: laneAbs & laneClamp", "[stereo]", float, double)
+{
+    using T = TestType;
+
+    STATIC_REQUIRE(laneAbs(T(-1)) == T(1));
+    STATIC_REQUIRE(laneClamp(T(2), T(-1), T(1)) == T(1));
+
+    auto const abs = laneAbs(StereoFrame<T>{T(-1), T(2)});
+    REQUIRE(abs.left == T(1));
+    REQUIRE(abs.right == T(2));
+
+    auto const clamped = laneClamp(StereoFrame<T>{T(-3), T(0.5)}, T(-1), T(1));
+    REQUIRE(clamped.left == T(-1));
+    REQUIRE(clamped.right == T(0.5));
+}
@@ -8,6 +8,14 @@ struct StereoFrame
 {
     using SampleType = Float;
 
+    friend constexpr auto operator-(StereoFrame frame) -> StereoFrame
+    {
+        return {
+            -frame.left,
+            -frame.right,
+        };
+    }
+
     friend constexpr auto operator+(StereoFrame lhs, Float rhs) -> StereoFrame
     {
         return {
@@ -40,6 +48,38 @@ struct StereoFrame
         };
     }
 
+    friend constexpr auto operator+(Float lhs, StereoFrame rhs) -> StereoFrame
+    {
+        return {
+            lhs + rhs.left,
+            lhs + rhs.right,
+        };
+    }
+
+    friend constexpr auto operator-(Float lhs, StereoFrame rhs) -> StereoFrame
+    {
+        return {
+            lhs - rhs.left,
+            lhs - rhs.right,
+        };
+    }
+
+    friend constexpr auto operator*(Float lhs, StereoFrame rhs) -> StereoFrame
+    {
+        return {
+            lhs * rhs.left,
+            lhs * rhs.right,
+        };
+    }
+
+    friend constexpr auto operator/(Float lhs, StereoFrame rhs) -> StereoFrame
+    {
+        return {
+            lhs / rhs.left,
+            lhs / rhs.right,
+        };
+    }
+
     friend constexpr auto operator+(StereoFrame lhs, StereoFrame rhs) -> StereoFrame
     {
         return {
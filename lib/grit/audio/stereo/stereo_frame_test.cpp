@@ -80,3 +80,33 @@ TEMPLATE_TEST_CASE("audio/stereo: operator/=(StereoFrame)", "[stereo]", float, d
     REQUIRE(result.left == Catch::Approx(0.5));
     REQUIRE(result.right == Catch::Approx(1));
 }
+
+TEMPLATE_TEST_CASE("audio/stereo: operator-(StereoFrame) unary", "[stereo]", float, double)
+{
+    using T           = TestType;
+    auto const result = -StereoFrame<T>{T(1), T(-2)};
+    REQUIRE(result.left == Catch::Approx(-1));
+    REQUIRE(result.right == Catch::Approx(2));
+}
+
+TEMPLATE_TEST_CASE("audio/stereo: operator(Float, StereoFrame)", "[stereo]", float, double)
+{
+    using T          = TestType;
+    auto const frame = StereoFrame<T>{T(1), T(2)};
+
+    auto const sum = T(1) + frame;
+    REQUIRE(sum.left == Catch::Approx(2));
+    REQUIRE(sum.right == Catch::Approx(3));
+
+    auto const difference = T(1) - frame;
+    REQUIRE(difference.left == Catch::Approx(0));
+    REQUIRE(difference.right == Catch::Approx(-1));
+
+    auto const product = T(2) * frame;
+    REQUIRE(product.left == Catch::Approx(2));
+    REQUIRE(product.right == Catch::Approx(4));
+
+    auto const quotient = T(1) / frame;
+    REQUIRE(quotient.left == Catch::Approx(1));
+    REQUIRE(quotient.right == Catch::Approx(0.5));
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
 
@@ -28,11 +29,11 @@ struct DiodeRectifierNonlinearity
 };
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using DiodeRectifier = WaveShaper<Float, DiodeRectifierNonlinearity<Float>>;
+template<Lane Sample>
+using DiodeRectifier = WaveShaper<Sample, DiodeRectifierNonlinearity<LaneValue<Sample>>>;
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using DiodeRectifierADAA1 = WaveShaperADAA1<Float, DiodeRectifierNonlinearity<Float>>;
+template<Lane Sample>
+using DiodeRectifierADAA1 = WaveShaperADAA1<Sample, DiodeRectifierNonlinearity<LaneValue<Sample>>>;
 
 }  // namespace grit
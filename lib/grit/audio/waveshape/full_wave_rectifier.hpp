@@ -1,5 +1,6 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
 #include <grit/math/sign.hpp>
@@ -22,11 +23,11 @@ struct FullWaveRectifierNonlinearity
 };
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using FullWaveRectifier = WaveShaper<Float, FullWaveRectifierNonlinearity<Float>>;
+template<Lane Sample>
+using FullWaveRectifier = WaveShaper<Sample, FullWaveRectifierNonlinearity<LaneValue<Sample>>>;
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using FullWaveRectifierADAA1 = WaveShaperADAA1<Float, FullWaveRectifierNonlinearity<Float>>;
+template<Lane Sample>
+using FullWaveRectifierADAA1 = WaveShaperADAA1<Sample, FullWaveRectifierNonlinearity<LaneValue<Sample>>>;
 
 }  // namespace grit
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
 
@@ -24,11 +25,11 @@ struct HalfWaveRectifierNonlinearity
 };
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using HalfWaveRectifier = WaveShaper<Float, HalfWaveRectifierNonlinearity<Float>>;
+template<Lane Sample>
+using HalfWaveRectifier = WaveShaper<Sample, HalfWaveRectifierNonlinearity<LaneValue<Sample>>>;
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using HalfWaveRectifierADAA1 = WaveShaperADAA1<Float, HalfWaveRectifierNonlinearity<Float>>;
+template<Lane Sample>
+using HalfWaveRectifierADAA1 = WaveShaperADAA1<Sample, HalfWaveRectifierNonlinearity<LaneValue<Sample>>>;
 
 }  // namespace grit
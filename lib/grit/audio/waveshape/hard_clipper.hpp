@@ -1,5 +1,6 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
 #include <grit/math/sign.hpp>
@@ -20,16 +21,16 @@ struct HardClipperNonlinearity
 
     [[nodiscard]] static constexpr auto ad1(Float x)
     {
-        return etl::abs(x) > Float(1) ? x * sign(x) : (x * x) * Float(0.5);
+        return etl::abs(x) > Float(1) ? x * sign(x) - Float(0.5) : (x * x) * Float(0.5);
     }
 };
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using HardClipper = WaveShaper<Float, HardClipperNonlinearity<Float>>;
+template<Lane Sample>
+using HardClipper = WaveShaper<Sample, HardClipperNonlinearity<LaneValue<Sample>>>;
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using HardClipperADAA1 = WaveShaperADAA1<Float, HardClipperNonlinearity<Float>>;
+template<Lane Sample>
+using HardClipperADAA1 = WaveShaperADAA1<Sample, HardClipperNonlinearity<LaneValue<Sample>>>;
 
 }  // namespace grit
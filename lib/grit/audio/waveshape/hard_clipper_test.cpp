@@ -19,3 +19,16 @@ TEMPLATE_TEST_CASE("audio/waveshape: HardClipper", "", float, double)
     REQUIRE(shaper(Float(+1.0)) == Catch::Approx(+1.0));
     REQUIRE(shaper(Float(+2.0)) == Catch::Approx(+1.0));
 }
+
+TEMPLATE_TEST_CASE("audio/waveshape: HardClipperADAA1", "", float, double)
+{
+    using Float = TestType;
+
+    // The antiderivative has to be continuous at the clipping threshold
+    auto shaper = grit::HardClipperADAA1<Float>{};
+    static_cast<void>(shaper(Float(0.99)));
+    REQUIRE(shaper(Float(1.01)) == Catch::Approx(0.9975).margin(1e-4));
+    REQUIRE(shaper(Float(2.00)) == Catch::Approx(1.0).margin(1e-3));
+    REQUIRE(shaper(Float(-2.0)) == Catch::Approx(0.0).margin(1e-3));
+    REQUIRE(shaper(Float(-0.5)) == Catch::Approx(-0.91667).margin(1e-4));
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/audio/waveshape/wave_shaper.hpp>
 #include <grit/audio/waveshape/wave_shaper_adaa1.hpp>
 
@@ -31,11 +32,11 @@ struct TanhClipperNonlinearity
 };
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using TanhClipper = WaveShaper<Float, TanhClipperNonlinearity<Float>>;
+template<Lane Sample>
+using TanhClipper = WaveShaper<Sample, TanhClipperNonlinearity<LaneValue<Sample>>>;
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float>
-using TanhClipperADAA1 = WaveShaperADAA1<Float, TanhClipperNonlinearity<Float>>;
+template<Lane Sample>
+using TanhClipperADAA1 = WaveShaperADAA1<Sample, TanhClipperNonlinearity<LaneValue<Sample>>>;
 
 }  // namespace grit
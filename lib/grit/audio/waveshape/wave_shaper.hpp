@@ -1,15 +1,19 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
+
 #include <etl/concepts.hpp>
+#include <etl/span.hpp>
 #include <etl/type_traits.hpp>
 
 namespace grit {
 
+/// \brief Memoryless waveshaper, applies the function to each lane.
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float, typename Function = Float (*)(Float)>
+template<Lane Sample, typename Function = LaneValue<Sample> (*)(LaneValue<Sample>)>
 struct WaveShaper
 {
-    using SampleType = Float;
+    using SampleType = Sample;
 
     WaveShaper()
         requires(etl::is_empty_v<Function>)
@@ -21,7 +25,20 @@ struct WaveShaper
 
     static auto reset() -> void {}
 
-    [[nodiscard]] auto operator()(Float input) const -> Float { return _function(input); }
+    [[nodiscard]] auto operator()(Sample input) const -> Sample { return lanewise(_function, input); }
+
+    /// Shapes input into output, both of the same size. Memoryless, so the
+    /// loop vectorizes if the function is visible to the compiler.
+    auto process(etl::span<Sample const> input, etl::span<Sample> output) const -> void
+    {
+        auto const function = _function;
+        for (auto i = etl::size_t(0); i < output.size(); ++i) {
+            output[i] = lanewise(function, input[i]);
+        }
+    }
+
+    /// Shapes the buffer in-place.
+    auto process(etl::span<Sample> buffer) const -> void { process(etl::span<Sample const>{buffer}, buffer); }
 
 private:
     TETL_NO_UNIQUE_ADDRESS Function _function;
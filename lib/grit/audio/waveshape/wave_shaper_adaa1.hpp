@@ -1,41 +1,76 @@
 #pragma once
 
+#include <grit/audio/stereo/lane.hpp>
+
 #include <etl/cmath.hpp>
 #include <etl/concepts.hpp>
+#include <etl/span.hpp>
 
 namespace grit {
 
 /// \ingroup grit-audio-waveshape
-template<etl::floating_point Float, typename Nonlinearity>
+template<Lane Sample, typename Nonlinearity>
 struct WaveShaperADAA1
 {
-    using SampleType = Float;
+    using SampleType = Sample;
+    using Float      = LaneValue<Sample>;
 
     constexpr WaveShaperADAA1() = default;
 
     constexpr auto reset() -> void
     {
-        _xm1   = Float(0);
-        _ad1m1 = Float(0);
+        _xm1   = Sample{};
+        _ad1m1 = Sample{};
+    }
+
+    [[nodiscard]] constexpr auto operator()(Sample x) -> Sample { return tick(x, _xm1, _ad1m1); }
+
+    /// Shapes input into output, both of the same size.
+    constexpr auto process(etl::span<Sample const> input, etl::span<Sample> output) -> void
+    {
+        // Local state, stores to output can't alias it
+        auto xm1   = _xm1;
+        auto ad1m1 = _ad1m1;
+        for (auto i = etl::size_t(0); i < output.size(); ++i) {
+            output[i] = tick(input[i], xm1, ad1m1);
+        }
+
+        _xm1   = xm1;
+        _ad1m1 = ad1m1;
+    }
+
+    /// Shapes the buffer in-place.
+    constexpr auto process(etl::span<Sample> buffer) -> void { process(etl::span<Sample const>{buffer}, buffer); }
+
+private:
+    [[nodiscard]] constexpr auto tick(Sample x, Sample& xm1, Sample& ad1m1) const -> Sample
+    {
+        if constexpr (etl::floating_point<Sample>) {
+            return tickLane(x, xm1, ad1m1);
+        } else {
+            return {
+                tickLane(x.left, xm1.left, ad1m1.left),
+                tickLane(x.right, xm1.right, ad1m1.right),
+            };
+        }
     }
 
-    [[nodiscard]] constexpr auto operator()(Float x) -> Float
+    [[nodiscard]] constexpr auto tickLane(Float x, Float& xm1, Float& ad1m1) const -> Float
     {
-        auto const tooSmall = etl::abs(x - _xm1) < tolerance;
+        auto const tooSmall = etl::abs(x - xm1) < tolerance;
         auto const ad1      = _nl.ad1(x);
-        auto const y        = tooSmall ? _nl.f((x + _xm1) * Float(0.5)) : (ad1 - _ad1m1) / (x - _xm1);
+        auto const y        = tooSmall ? _nl.f((x + xm1) * Float(0.5)) : (ad1 - ad1m1) / (x - xm1);
 
-        _xm1   = x;
-        _ad1m1 = ad1;
+        xm1   = x;
+        ad1m1 = ad1;
 
         return y;
     }
 
-private:
     static constexpr auto const tolerance = Float(1e-3);
 
-    Float _xm1{0};
-    Float _ad1m1{0};
+    Sample _xm1{};
+    Sample _ad1m1{};
     TETL_NO_UNIQUE_ADDRESS Nonlinearity _nl;
 };
 
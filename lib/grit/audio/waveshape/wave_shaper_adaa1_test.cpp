@@ -2,7 +2,13 @@
 #include "half_wave_rectifier.hpp"
 #include "hard_clipper.hpp"
 
+#include <grit/audio/processor/process_test.hpp>
+
+#include <etl/array.hpp>
+#include <etl/random.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 
 TEMPLATE_PRODUCT_TEST_CASE(
@@ -27,3 +33,57 @@ TEMPLATE_PRODUCT_TEST_CASE(
     REQUIRE(shaper(0.1) == Catch::Approx(0.1));
     REQUIRE(shaper(0.1) == Catch::Approx(0.1));
 }
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/waveshape: WaveShaperADAA1::process",
+    "",
+    (grit::FullWaveRectifierADAA1, grit::HalfWaveRectifierADAA1, grit::HardClipperADAA1),
+    (float, double)
+)
+{
+    using Waveshaper = TestType;
+    using Float      = typename Waveshaper::SampleType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto input = etl::array<Float, 256>{};
+    for (auto& x : input) {
+        x = dist(rng);
+    }
+
+    grit::testing::requireBitExactBlocks(Waveshaper{}, input);
+}
+
+/// Both lanes of a stereo shaper are bit-exact to a mono shaper per channel.
+template<template<typename> typename Shaper, typename Float>
+auto requireBitExactLanes() -> void
+{
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto stereo = Shaper<Frame>{};
+    auto left   = Shaper<Float>{};
+    auto right  = Shaper<Float>{};
+    STATIC_REQUIRE(sizeof(stereo) == sizeof(Frame) * 2);
+
+    // Repeating the right input takes the ill-conditioned branch in that lane only
+    auto x = Frame{};
+    for (auto i = 0; i < 256; ++i) {
+        x.left  = dist(rng);
+        x.right = i % 3 == 0 ? x.right : dist(rng);
+
+        auto const y = stereo(x);
+        REQUIRE(y.left == left(x.left));
+        REQUIRE(y.right == right(x.right));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/waveshape: WaveShaperADAA1<StereoFrame>", "", float, double)
+{
+    requireBitExactLanes<grit::FullWaveRectifierADAA1, TestType>();
+    requireBitExactLanes<grit::HalfWaveRectifierADAA1, TestType>();
+    requireBitExactLanes<grit::HardClipperADAA1, TestType>();
+}
@@ -2,7 +2,13 @@
 #include "half_wave_rectifier.hpp"
 #include "hard_clipper.hpp"
 
+#include <grit/audio/processor/process_test.hpp>
+
+#include <etl/array.hpp>
+#include <etl/random.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 
 TEMPLATE_PRODUCT_TEST_CASE(
@@ -25,3 +31,52 @@ TEMPLATE_PRODUCT_TEST_CASE(
     REQUIRE(shaper(Float(0.1)) == Catch::Approx(0.1));
     REQUIRE(shaper(Float(0.1)) == Catch::Approx(0.1));
 }
+
+TEMPLATE_PRODUCT_TEST_CASE(
+    "audio/waveshape: WaveShaper::process",
+    "",
+    (grit::FullWaveRectifier, grit::HalfWaveRectifier, grit::HardClipper),
+    (float, double)
+)
+{
+    using Waveshaper = TestType;
+    using Float      = typename Waveshaper::SampleType;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto input = etl::array<Float, 256>{};
+    for (auto& x : input) {
+        x = dist(rng);
+    }
+
+    grit::testing::requireBitExactBlocks(Waveshaper{}, input);
+}
+
+/// Both lanes of a stereo shaper are bit-exact to a mono shaper per channel.
+template<template<typename> typename Shaper, typename Float>
+auto requireBitExactLanes() -> void
+{
+    using Frame = grit::StereoFrame<Float>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-2), Float(2)};
+
+    auto const stereo = Shaper<Frame>{};
+    auto const mono   = Shaper<Float>{};
+    STATIC_REQUIRE(etl::is_empty_v<Shaper<Frame>>);
+
+    for (auto i = 0; i < 256; ++i) {
+        auto const x = Frame{dist(rng), dist(rng)};
+        auto const y = stereo(x);
+        REQUIRE(y.left == mono(x.left));
+        REQUIRE(y.right == mono(x.right));
+    }
+}
+
+TEMPLATE_TEST_CASE("audio/waveshape: WaveShaper<StereoFrame>", "", float, double)
+{
+    requireBitExactLanes<grit::FullWaveRectifier, TestType>();
+    requireBitExactLanes<grit::HalfWaveRectifier, TestType>();
+    requireBitExactLanes<grit::HardClipper, TestType>();
+}
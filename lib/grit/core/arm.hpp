@@ -15,46 +15,139 @@
 
 namespace grit::arm {
 
+namespace detail {
+
+[[nodiscard]] constexpr auto lo16(etl::uint32_t x) -> etl::int32_t
+{
+    return static_cast<etl::int16_t>(static_cast<etl::uint16_t>(x & 0xFFFFU));
+}
+
+[[nodiscard]] constexpr auto hi16(etl::uint32_t x) -> etl::int32_t
+{
+    return static_cast<etl::int16_t>(static_cast<etl::uint16_t>(x >> 16U));
+}
+
+[[nodiscard]] constexpr auto pack16(etl::int32_t lo, etl::int32_t hi) -> etl::uint32_t
+{
+    auto const bottom = static_cast<etl::uint32_t>(lo) & etl::uint32_t(0x0000FFFFUL);
+    auto const top    = static_cast<etl::uint32_t>(hi) << 16U;
+    return bottom | top;
+}
+
+[[nodiscard]] constexpr auto sat16(etl::int32_t x) -> etl::int32_t { return etl::clamp(x, TA_Q15_MIN, TA_Q15_MAX); }
+
+}  // namespace detail
+
+/// Saturating parallel add of two packed int16 pairs
 TA_ALWAYS_INLINE inline auto qadd16(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("qadd16 %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    auto const lo = detail::sat16(detail::lo16(op1) + detail::lo16(op2));
+    auto const hi = detail::sat16(detail::hi16(op1) + detail::hi16(op2));
+    return detail::pack16(lo, hi);
+#endif
 }
 
+/// Saturating parallel subtract of two packed int16 pairs
 TA_ALWAYS_INLINE inline auto qsub16(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("qsub16 %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    auto const lo = detail::sat16(detail::lo16(op1) - detail::lo16(op2));
+    auto const hi = detail::sat16(detail::hi16(op1) - detail::hi16(op2));
+    return detail::pack16(lo, hi);
+#endif
 }
 
+/// Halving parallel add of two packed int16 pairs, can not overflow
+TA_ALWAYS_INLINE inline auto shadd16(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
+{
+#if __arm__
+    auto result = etl::uint32_t{};
+    __asm volatile("shadd16 %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
+    return result;
+#else
+    auto const lo = (detail::lo16(op1) + detail::lo16(op2)) >> 1;
+    auto const hi = (detail::hi16(op1) + detail::hi16(op2)) >> 1;
+    return detail::pack16(lo, hi);
+#endif
+}
+
+/// Halving parallel subtract of two packed int16 pairs, can not overflow
+TA_ALWAYS_INLINE inline auto shsub16(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
+{
+#if __arm__
+    auto result = etl::uint32_t{};
+    __asm volatile("shsub16 %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
+    return result;
+#else
+    auto const lo = (detail::lo16(op1) - detail::lo16(op2)) >> 1;
+    auto const hi = (detail::hi16(op1) - detail::hi16(op2)) >> 1;
+    return detail::pack16(lo, hi);
+#endif
+}
+
+/// lo * lo + hi * hi
 TA_ALWAYS_INLINE inline auto smuad(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smuad %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    auto const lo = detail::lo16(op1) * detail::lo16(op2);
+    auto const hi = detail::hi16(op1) * detail::hi16(op2);
+    return static_cast<etl::uint32_t>(lo) + static_cast<etl::uint32_t>(hi);
+#endif
 }
 
+/// lo * hi + hi * lo
 TA_ALWAYS_INLINE inline auto smuadx(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smuadx %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    auto const a = detail::lo16(op1) * detail::hi16(op2);
+    auto const b = detail::hi16(op1) * detail::lo16(op2);
+    return static_cast<etl::uint32_t>(a) + static_cast<etl::uint32_t>(b);
+#endif
 }
 
+/// lo * lo - hi * hi
 TA_ALWAYS_INLINE inline auto smusd(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smusd %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    auto const lo = detail::lo16(op1) * detail::lo16(op2);
+    auto const hi = detail::hi16(op1) * detail::hi16(op2);
+    return static_cast<etl::uint32_t>(lo) - static_cast<etl::uint32_t>(hi);
+#endif
 }
 
+/// lo * hi - hi * lo
 TA_ALWAYS_INLINE inline auto smusdx(etl::uint32_t op1, etl::uint32_t op2) -> etl::uint32_t
 {
+#if __arm__
     auto result = etl::uint32_t{};
     __asm volatile("smusdx %0, %1, %2" : "=r"(result) : "r"(op1), "r"(op2));
     return result;
+#else
+    auto const a = detail::lo16(op1) * detail::hi16(op2);
+    auto const b = detail::hi16(op1) * detail::lo16(op2);
+    return static_cast<etl::uint32_t>(a) - static_cast<etl::uint32_t>(b);
+#endif
 }
 
 TA_ALWAYS_INLINE inline auto ssat16(etl::int32_t x) -> etl::int16_t
@@ -0,0 +1,56 @@
+#include "arm.hpp"
+
+#include <etl/limits.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+auto pack(etl::int16_t lo, etl::int16_t hi) -> etl::uint32_t { return grit::arm::pkhbt(lo, hi, 16); }
+}  // namespace
+
+TEST_CASE("core: pkhbt")
+{
+    STATIC_REQUIRE(grit::arm::pkhbt(1, 2, 16) == 0x0002'0001U);
+    STATIC_REQUIRE(grit::arm::pkhbt(-1, 0, 16) == 0x0000'FFFFU);
+    STATIC_REQUIRE(grit::arm::pkhbt(0, -1, 16) == 0xFFFF'0000U);
+}
+
+TEST_CASE("core: qadd16/qsub16")
+{
+    REQUIRE(grit::arm::qadd16(pack(1, -2), pack(3, -4)) == pack(4, -6));
+    REQUIRE(grit::arm::qsub16(pack(1, -2), pack(3, -4)) == pack(-2, 2));
+
+    // saturation
+    REQUIRE(grit::arm::qadd16(pack(32000, -32000), pack(1000, -1000)) == pack(32767, -32768));
+    REQUIRE(grit::arm::qsub16(pack(-32000, 32000), pack(1000, -1000)) == pack(-32768, 32767));
+}
+
+TEST_CASE("core: shadd16/shsub16")
+{
+    REQUIRE(grit::arm::shadd16(pack(32767, -32768), pack(32767, -32768)) == pack(32767, -32768));
+    REQUIRE(grit::arm::shadd16(pack(3, -3), 0) == pack(1, -2));
+    REQUIRE(grit::arm::shsub16(pack(-32768, 32767), pack(32767, -32768)) == pack(-32768, 32767));
+    REQUIRE(grit::arm::shsub16(pack(10, 10), pack(4, 20)) == pack(3, -5));
+}
+
+TEST_CASE("core: smuad/smusd")
+{
+    auto const a = pack(3, -5);
+    auto const b = pack(7, 11);
+
+    REQUIRE(static_cast<etl::int32_t>(grit::arm::smuad(a, b)) == 3 * 7 + -5 * 11);
+    REQUIRE(static_cast<etl::int32_t>(grit::arm::smusd(a, b)) == 3 * 7 - -5 * 11);
+    REQUIRE(static_cast<etl::int32_t>(grit::arm::smuadx(a, b)) == 3 * 11 + -5 * 7);
+    REQUIRE(static_cast<etl::int32_t>(grit::arm::smusdx(a, b)) == 3 * 11 - -5 * 7);
+
+    // 2^31 wraps around like the hardware instruction
+    auto const min = pack(-32768, -32768);
+    REQUIRE(static_cast<etl::int32_t>(grit::arm::smuad(min, min)) == etl::numeric_limits<etl::int32_t>::min());
+}
+
+TEST_CASE("core: ssat16")
+{
+    REQUIRE(grit::arm::ssat16(0) == 0);
+    REQUIRE(grit::arm::ssat16(40000) == 32767);
+    REQUIRE(grit::arm::ssat16(-40000) == -32768);
+}
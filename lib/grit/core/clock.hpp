@@ -0,0 +1,77 @@
+#pragma once
+
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+
+#if not __arm__
+    #include <chrono>
+#endif
+
+namespace grit {
+
+/// \brief Clock policy for LoadMeter & profiling zones. Provides monotonic
+/// ticks, which may wrap around. Only differences of ticks are meaningful.
+template<typename Clock>
+concept TickClock = requires {
+    { Clock::now() } -> etl::same_as<etl::uint32_t>;
+};
+
+#if __arm__
+
+/// \brief Cortex-M DWT cycle counter, ticks at the core clock.
+struct CycleCounterClock
+{
+    /// Enables the trace unit & starts the counter. Call once before the first measurement.
+    static auto enable() -> void
+    {
+        static constexpr auto trcena      = etl::uint32_t(1) << 24U;
+        static constexpr auto cyccntena   = etl::uint32_t(1) << 0U;
+        static constexpr auto unlockValue = etl::uint32_t(0xC5ACCE55);
+
+        *reg(demcr) = *reg(demcr) | trcena;
+
+        // The lock access register only exists on the Cortex-M7
+        *reg(dwtLar) = unlockValue;
+
+        *reg(dwtCyccnt) = 0;
+        *reg(dwtCtrl)   = *reg(dwtCtrl) | cyccntena;
+    }
+
+    [[nodiscard]] static auto now() -> etl::uint32_t { return *reg(dwtCyccnt); }
+
+private:
+    static constexpr auto demcr     = etl::uintptr_t(0xE000'EDFC);
+    static constexpr auto dwtCtrl   = etl::uintptr_t(0xE000'1000);
+    static constexpr auto dwtCyccnt = etl::uintptr_t(0xE000'1004);
+    static constexpr auto dwtLar    = etl::uintptr_t(0xE000'1FB0);
+
+    [[nodiscard]] static auto reg(etl::uintptr_t address) -> etl::uint32_t volatile*
+    {
+        return reinterpret_cast<etl::uint32_t volatile*>(address);  // NOLINT
+    }
+};
+
+/// \brief Default clock of the platform.
+using DefaultClock = CycleCounterClock;
+
+#else
+
+/// \brief std::chrono::steady_clock in nanoseconds, for host builds. Wraps
+/// around after ~4.3s, which is plenty for a single callback.
+struct SteadyClock
+{
+    static constexpr auto ticksPerSecond = 1'000'000'000.0F;
+
+    [[nodiscard]] static auto now() -> etl::uint32_t
+    {
+        auto const time = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<etl::uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(time).count());
+    }
+};
+
+/// \brief Default clock of the platform.
+using DefaultClock = SteadyClock;
+
+#endif
+
+}  // namespace grit
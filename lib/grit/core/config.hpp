@@ -7,3 +7,13 @@
 #else
     #define TA_ALWAYS_INLINE
 #endif
+
+// Set to 1 to enable the GRIT_PROFILE_ZONE instrumentation, see grit/core/profile.hpp
+#if not defined(GRIT_ENABLE_PROFILING)
+    #define GRIT_ENABLE_PROFILING 0
+#endif
+
+// Set to 1 to enforce the GRIT_RAM_BUDGET checks, see grit/core/footprint.hpp
+#if not defined(GRIT_ENABLE_RAM_BUDGETS)
+    #define GRIT_ENABLE_RAM_BUDGETS 0
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <grit/core/config.hpp>
+
+#include <etl/cstddef.hpp>
+
+/// \brief Fails compilation if sizeof(type) exceeds bytes. Expands to nothing
+/// unless GRIT_ENABLE_RAM_BUDGETS is set. The diagnostic names both numbers
+/// as template arguments of grit::RamBudget.
+///
+/// \code
+/// GRIT_RAM_BUDGET(grit::Poseidon, 31 * 1024);
+/// \endcode
+#if GRIT_ENABLE_RAM_BUDGETS
+    #define GRIT_RAM_BUDGET(type, bytes) static_assert(::grit::fitsRamBudget<type, (bytes)>)
+#else
+    #define GRIT_RAM_BUDGET(type, bytes) static_assert(true)
+#endif
+
+namespace grit {
+
+/// \brief Size & alignment of a processor or module, i.e. the RAM taken by its state.
+struct Footprint
+{
+    etl::size_t size{0};
+    etl::size_t alignment{0};
+};
+
+template<typename T>
+inline constexpr auto footprint = Footprint{.size = sizeof(T), .alignment = alignof(T)};
+
+template<etl::size_t Size, etl::size_t Budget>
+struct RamBudget
+{
+    static constexpr auto value = Size <= Budget;
+    static_assert(value, "state exceeds its RAM budget, see RamBudget<Size, Budget>");
+};
+
+/// \brief True if T fits into Budget bytes, fails compilation otherwise.
+template<typename T, etl::size_t Budget>
+inline constexpr auto fitsRamBudget = RamBudget<sizeof(T), Budget>::value;
+
+}  // namespace grit
@@ -0,0 +1,18 @@
+#include "footprint.hpp"
+
+#include <grit/audio.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("core: footprint")
+{
+    STATIC_REQUIRE(grit::footprint<float>.size == 4);
+    STATIC_REQUIRE(grit::footprint<float>.alignment == 4);
+    STATIC_REQUIRE(grit::footprint<grit::Biquad<double>>.size == sizeof(grit::Biquad<double>));
+    STATIC_REQUIRE(grit::footprint<grit::Biquad<double>>.alignment == alignof(double));
+
+    STATIC_REQUIRE(grit::fitsRamBudget<float, 4>);
+    STATIC_REQUIRE(grit::fitsRamBudget<grit::Biquad<float>, sizeof(grit::Biquad<float>)>);
+
+    GRIT_RAM_BUDGET(grit::Biquad<float>, 1024);
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <grit/core/clock.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/cstdint.hpp>
+
+namespace grit {
+
+/// \brief Measures the duration of each audio callback as a fraction of the block period.
+///
+/// \details Keeps running min/avg/max and a histogram with NumBuckets equally
+/// sized buckets over [0, 1). The last bucket also counts overruns (load >= 1).
+/// The measurement side is meant to run in the audio interrupt, snapshot() may
+/// be called from the main loop at any time. A sequence counter guards against
+/// torn reads, if the callback interrupts the copy the snapshot is retried.
+template<TickClock Clock, etl::size_t NumBuckets = 8>
+struct LoadMeter
+{
+    struct Snapshot
+    {
+        float min{0};
+        float avg{0};
+        float max{0};
+        etl::uint32_t count{0};
+        etl::uint32_t overruns{0};
+        etl::array<etl::uint32_t, NumBuckets> histogram{};
+    };
+
+    LoadMeter() = default;
+
+    /// ticksPerSecond is the frequency of the Clock, e.g. the core clock for CycleCounterClock.
+    auto prepare(float sampleRate, etl::size_t blockSize, float ticksPerSecond) -> void;
+    auto reset() -> void;
+
+    auto begin() -> void;
+    auto end() -> void;
+
+    [[nodiscard]] auto snapshot() const -> Snapshot;
+
+    /// Load of a single callback, ticks divided by the block period.
+    [[nodiscard]] auto load(etl::uint32_t ticks) const -> float;
+
+private:
+    static auto barrier() -> void { asm volatile("" : : : "memory"); }
+
+    auto record(etl::uint32_t ticks) -> void;
+
+    float _ticksPerBlock{1};
+    etl::uint32_t _start{0};
+
+    etl::uint32_t volatile _sequence{0};
+    etl::uint32_t _minTicks{0};
+    etl::uint32_t _maxTicks{0};
+    etl::uint64_t _sumTicks{0};
+    etl::uint32_t _count{0};
+    etl::uint32_t _overruns{0};
+    etl::array<etl::uint32_t, NumBuckets> _histogram{};
+};
+
+/// \brief Measures the enclosing scope with a LoadMeter.
+template<typename Meter>
+struct ScopedLoadMeasurement
+{
+    explicit ScopedLoadMeasurement(Meter& meter) : _meter{meter} { _meter.begin(); }
+
+    ~ScopedLoadMeasurement() { _meter.end(); }
+
+    ScopedLoadMeasurement(ScopedLoadMeasurement const& other)                    = delete;
+    ScopedLoadMeasurement(ScopedLoadMeasurement&& other)                         = delete;
+    auto operator=(ScopedLoadMeasurement const& other) -> ScopedLoadMeasurement& = delete;
+    auto operator=(ScopedLoadMeasurement&& other) -> ScopedLoadMeasurement&      = delete;
+
+private:
+    Meter& _meter;
+};
+
+template<TickClock Clock, etl::size_t NumBuckets>
+auto LoadMeter<Clock, NumBuckets>::prepare(float sampleRate, etl::size_t blockSize, float ticksPerSecond) -> void
+{
+    _ticksPerBlock = ticksPerSecond * static_cast<float>(blockSize) / sampleRate;
+    reset();
+}
+
+template<TickClock Clock, etl::size_t NumBuckets>
+auto LoadMeter<Clock, NumBuckets>::reset() -> void
+{
+    _sequence = _sequence + 1U;
+    barrier();
+
+    _minTicks = 0;
+    _maxTicks = 0;
+    _sumTicks = 0;
+    _count    = 0;
+    _overruns = 0;
+    _histogram.fill(0);
+
+    barrier();
+    _sequence = _sequence + 1U;
+}
+
+template<TickClock Clock, etl::size_t NumBuckets>
+auto LoadMeter<Clock, NumBuckets>::begin() -> void
+{
+    _start = Clock::now();
+}
+
+template<TickClock Clock, etl::size_t NumBuckets>
+auto LoadMeter<Clock, NumBuckets>::end() -> void
+{
+    record(Clock::now() - _start);
+}
+
+template<TickClock Clock, etl::size_t NumBuckets>
+auto LoadMeter<Clock, NumBuckets>::load(etl::uint32_t ticks) const -> float
+{
+    return static_cast<float>(ticks) / _ticksPerBlock;
+}
+
+template<TickClock Clock, etl::size_t NumBuckets>
+auto LoadMeter<Clock, NumBuckets>::record(etl::uint32_t ticks) -> void
+{
+    auto const fraction = load(ticks);
+    auto const bucket   = etl::min(static_cast<etl::size_t>(fraction * float(NumBuckets)), NumBuckets - 1);
+
+    _sequence = _sequence + 1U;
+    barrier();
+
+    _minTicks = _count == 0 ? ticks : etl::min(_minTicks, ticks);
+    _maxTicks = etl::max(_maxTicks, ticks);
+    _sumTicks += ticks;
+    _count += 1;
+    _overruns += fraction >= 1.0F ? 1U : 0U;
+    _histogram[bucket] += 1;
+
+    barrier();
+    _sequence = _sequence + 1U;
+}
+
+template<TickClock Clock, etl::size_t NumBuckets>
+auto LoadMeter<Clock, NumBuckets>::snapshot() const -> Snapshot
+{
+    while (true) {
+        auto const sequence = _sequence;
+        barrier();
+
+        auto result = Snapshot{
+            .min       = load(_minTicks),
+            .avg       = _count == 0 ? 0.0F : static_cast<float>(_sumTicks) / (float(_count) * _ticksPerBlock),
+            .max       = load(_maxTicks),
+            .count     = _count,
+            .overruns  = _overruns,
+            .histogram = _histogram,
+        };
+
+        barrier();
+        if ((sequence & 1U) == 0 and sequence == _sequence) {
+            return result;
+        }
+    }
+}
+
+}  // namespace grit
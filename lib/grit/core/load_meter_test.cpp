@@ -0,0 +1,93 @@
+#include "load_meter.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+struct FakeClock
+{
+    [[nodiscard]] static auto now() -> etl::uint32_t { return ticks; }
+
+    static inline auto ticks = etl::uint32_t{0};
+};
+
+// 1000 ticks per second, 100 samples at 1kHz -> 100 ticks per block
+auto measure(grit::LoadMeter<FakeClock, 4>& meter, etl::uint32_t duration) -> void
+{
+    meter.begin();
+    FakeClock::ticks += duration;
+    meter.end();
+}
+
+}  // namespace
+
+TEST_CASE("core: LoadMeter")
+{
+    auto meter = grit::LoadMeter<FakeClock, 4>{};
+    meter.prepare(1'000.0F, 100, 1'000.0F);
+
+    auto empty = meter.snapshot();
+    REQUIRE(empty.count == 0);
+    REQUIRE(empty.avg == 0.0F);
+
+    measure(meter, 10);
+    measure(meter, 30);
+    measure(meter, 60);
+    measure(meter, 80);
+
+    auto const stats = meter.snapshot();
+    REQUIRE(stats.count == 4);
+    REQUIRE(stats.overruns == 0);
+    REQUIRE_THAT(stats.min, Catch::Matchers::WithinAbs(0.1, 1e-6));
+    REQUIRE_THAT(stats.avg, Catch::Matchers::WithinAbs(0.45, 1e-6));
+    REQUIRE_THAT(stats.max, Catch::Matchers::WithinAbs(0.8, 1e-6));
+    REQUIRE(stats.histogram[0] == 1);
+    REQUIRE(stats.histogram[1] == 1);
+    REQUIRE(stats.histogram[2] == 1);
+    REQUIRE(stats.histogram[3] == 1);
+
+    meter.reset();
+    REQUIRE(meter.snapshot().count == 0);
+    REQUIRE(meter.snapshot().max == 0.0F);
+}
+
+TEST_CASE("core: LoadMeter overrun")
+{
+    auto meter = grit::LoadMeter<FakeClock, 4>{};
+    meter.prepare(1'000.0F, 100, 1'000.0F);
+
+    measure(meter, 100);
+    measure(meter, 250);
+
+    auto const stats = meter.snapshot();
+    REQUIRE(stats.count == 2);
+    REQUIRE(stats.overruns == 2);
+    REQUIRE(stats.histogram[3] == 2);
+    REQUIRE_THAT(stats.max, Catch::Matchers::WithinAbs(2.5, 1e-6));
+}
+
+TEST_CASE("core: LoadMeter clock wrap around")
+{
+    auto meter = grit::LoadMeter<FakeClock, 4>{};
+    meter.prepare(1'000.0F, 100, 1'000.0F);
+
+    FakeClock::ticks = etl::uint32_t(0xFFFF'FFF0);
+    measure(meter, 0x20);
+
+    REQUIRE_THAT(meter.snapshot().max, Catch::Matchers::WithinAbs(0.32, 1e-6));
+}
+
+TEST_CASE("core: ScopedLoadMeasurement")
+{
+    auto meter = grit::LoadMeter<FakeClock, 4>{};
+    meter.prepare(1'000.0F, 100, 1'000.0F);
+
+    {
+        auto const scope = grit::ScopedLoadMeasurement{meter};
+        FakeClock::ticks += 50;
+    }
+
+    REQUIRE(meter.snapshot().count == 1);
+    REQUIRE_THAT(meter.snapshot().avg, Catch::Matchers::WithinAbs(0.5, 1e-6));
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <grit/core/clock.hpp>
+#include <grit/core/config.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/cstdint.hpp>
+
+/// \brief Accumulates the ticks & calls of the enclosing scope under name.
+/// Expands to nothing unless GRIT_ENABLE_PROFILING is set.
+///
+/// \code
+/// GRIT_PROFILE_ZONE("Poseidon::process");
+/// auto const env = GRIT_PROFILE_EXPR("Poseidon::envelope", _envelope(sample));
+/// \endcode
+#if GRIT_ENABLE_PROFILING
+    #define GRIT_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define GRIT_PROFILE_CONCAT(a, b)      GRIT_PROFILE_CONCAT_IMPL(a, b)
+    #define GRIT_PROFILE_ZONE(name)                                                                                    \
+        ::grit::profile::ScopedZone<name> const GRIT_PROFILE_CONCAT(gritProfileZone, __LINE__) {}
+    #define GRIT_PROFILE_EXPR(name, ...)                                                                               \
+        ::grit::profile::measure<name>([&]() -> decltype(auto) { return __VA_ARGS__; })
+#else
+    #define GRIT_PROFILE_ZONE(name)      static_cast<void>(0)
+    #define GRIT_PROFILE_EXPR(name, ...) (__VA_ARGS__)
+#endif
+
+namespace grit::profile {
+
+/// \brief Compile-time name of a zone.
+template<etl::size_t N>
+struct ZoneName
+{
+    constexpr ZoneName(char const (&str)[N]) { etl::copy(str, str + N, data.begin()); }  // NOLINT
+
+    etl::array<char, N> data{};
+};
+
+/// \brief Statistics of a single zone. Ticks are of grit::DefaultClock.
+struct ZoneCounter
+{
+    explicit ZoneCounter(char const* zoneName);
+
+    ZoneCounter(ZoneCounter const& other)                    = delete;
+    ZoneCounter(ZoneCounter&& other)                         = delete;
+    auto operator=(ZoneCounter const& other) -> ZoneCounter& = delete;
+    auto operator=(ZoneCounter&& other) -> ZoneCounter&      = delete;
+
+    char const* name;
+    etl::uint64_t ticks{0};
+    etl::uint32_t calls{0};
+    ZoneCounter* next{nullptr};
+};
+
+namespace detail {
+inline constinit ZoneCounter* zones = nullptr;
+}  // namespace detail
+
+inline ZoneCounter::ZoneCounter(char const* zoneName) : name{zoneName}, next{detail::zones} { detail::zones = this; }
+
+/// \brief One counter per zone name, registered during static initialization.
+template<ZoneName Name>
+inline auto counter = ZoneCounter{Name.data.data()};
+
+template<ZoneName Name>
+struct ScopedZone
+{
+    ScopedZone() = default;
+
+    ~ScopedZone()
+    {
+        auto& zone = counter<Name>;
+        zone.ticks += DefaultClock::now() - _start;
+        zone.calls += 1;
+    }
+
+    ScopedZone(ScopedZone const& other)                    = delete;
+    ScopedZone(ScopedZone&& other)                         = delete;
+    auto operator=(ScopedZone const& other) -> ScopedZone& = delete;
+    auto operator=(ScopedZone&& other) -> ScopedZone&      = delete;
+
+private:
+    etl::uint32_t _start{DefaultClock::now()};
+};
+
+template<ZoneName Name, typename Func>
+auto measure(Func func) -> decltype(auto)
+{
+    auto const zone = ScopedZone<Name>{};
+    return func();
+}
+
+/// Calls func with every zone that was instantiated by the program.
+template<typename Func>
+auto forEachZone(Func func) -> void
+{
+    for (auto const* zone = detail::zones; zone != nullptr; zone = zone->next) {
+        func(*zone);
+    }
+}
+
+inline auto resetZones() -> void
+{
+    for (auto* zone = detail::zones; zone != nullptr; zone = zone->next) {
+        zone->ticks = 0;
+        zone->calls = 0;
+    }
+}
+
+}  // namespace grit::profile
@@ -0,0 +1,64 @@
+#include "profile.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string_view>
+
+namespace {
+
+[[nodiscard]] auto findZone(std::string_view name) -> grit::profile::ZoneCounter const*
+{
+    auto const* found = static_cast<grit::profile::ZoneCounter const*>(nullptr);
+    grit::profile::forEachZone([&](grit::profile::ZoneCounter const& zone) {
+        if (name == zone.name) {
+            found = &zone;
+        }
+    });
+    return found;
+}
+
+}  // namespace
+
+TEST_CASE("core: profile::ScopedZone")
+{
+    grit::profile::resetZones();
+
+    for (auto i{0}; i < 3; ++i) {
+        auto const zone = grit::profile::ScopedZone<"test::scope">{};
+    }
+
+    auto const* zone = findZone("test::scope");
+    REQUIRE(zone != nullptr);
+    REQUIRE(zone == &grit::profile::counter<"test::scope">);
+    REQUIRE(zone->calls == 3);
+
+    grit::profile::resetZones();
+    REQUIRE(zone->calls == 0);
+    REQUIRE(zone->ticks == 0);
+}
+
+TEST_CASE("core: profile::measure")
+{
+    grit::profile::resetZones();
+
+    auto const result = grit::profile::measure<"test::measure">([] { return 42; });
+    REQUIRE(result == 42);
+    REQUIRE(grit::profile::counter<"test::measure">.calls == 1);
+
+    // Same name, same counter
+    grit::profile::measure<"test::measure">([] {});
+    REQUIRE(grit::profile::counter<"test::measure">.calls == 2);
+}
+
+TEST_CASE("core: GRIT_PROFILE_EXPR")
+{
+    auto const add    = [](int a, int b) { return a + b; };
+    auto const result = GRIT_PROFILE_EXPR("test::expr", add(1, 2));
+    REQUIRE(result == 3);
+
+#if GRIT_ENABLE_PROFILING
+    REQUIRE(findZone("test::expr") != nullptr);
+#else
+    REQUIRE(findZone("test::expr") == nullptr);
+#endif
+}
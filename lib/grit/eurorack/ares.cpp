@@ -1,7 +1,6 @@
 #include "ares.hpp"
 
 #include <etl/algorithm.hpp>
-#include <etl/functional.hpp>
 
 namespace grit {
 
@@ -18,8 +17,7 @@ auto Ares::prepare(float sampleRate, etl::size_t blockSize) -> void
     _outputCV.setSampleRate(blockRate);
     _mixCV.setSampleRate(blockRate);
 
-    _channels[0].setSampleRate(sampleRate);
-    _channels[1].setSampleRate(sampleRate);
+    _channel.setSampleRate(sampleRate);
 }
 
 auto Ares::process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> void
@@ -42,13 +40,12 @@ auto Ares::process(StereoBlock<float> const& buffer, ControlInput const& inputs)
         .mix    = etl::clamp(mixKnob + mixCV, 0.0F, 1.0F),
     };
 
-    for (auto& channel : _channels) {
-        channel.setParameter(parameter);
-    }
+    _channel.setParameter(parameter);
 
     for (auto i = size_t(0); i < buffer.extent(1); ++i) {
-        buffer(0, i) = etl::invoke(_channels[0], buffer(0, i));
-        buffer(1, i) = etl::invoke(_channels[1], buffer(1, i));
+        auto const out = _channel({buffer(0, i), buffer(1, i)});
+        buffer(0, i)   = out.left;
+        buffer(1, i)   = out.right;
     }
 }
 
@@ -74,12 +71,12 @@ auto Ares::Channel::setSampleRate(float sampleRate) -> void
     _grind.setSampleRate(sampleRate);
 }
 
-auto Ares::Channel::operator()(float sample) -> float
+auto Ares::Channel::operator()(StereoFrame<float> frame) -> StereoFrame<float>
 {
     if (_mode == Mode::Fire) {
-        return _fire(sample);
+        return _fire(frame);
     }
-    return _grind(sample);
+    return _grind(frame);
 }
 
 }  // namespace grit
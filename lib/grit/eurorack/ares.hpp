@@ -4,8 +4,9 @@
 #include <grit/audio/airwindows/airwindows_grind_amp.hpp>
 #include <grit/audio/filter/dynamic_smoothing.hpp>
 #include <grit/audio/stereo/stereo_block.hpp>
+#include <grit/audio/stereo/stereo_frame.hpp>
 
-#include <etl/array.hpp>
+#include <etl/cstddef.hpp>
 
 namespace grit {
 
@@ -39,6 +40,7 @@ struct Ares
     auto process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> void;
 
 private:
+    /// Both channels as the lanes of a StereoFrame, sharing the amp coefficients.
     struct Channel
     {
         struct Parameter
@@ -55,13 +57,13 @@ private:
         auto setParameter(Parameter const& parameter) -> void;
         auto setSampleRate(float sampleRate) -> void;
 
-        [[nodiscard]] auto operator()(float sample) -> float;
+        [[nodiscard]] auto operator()(StereoFrame<float> frame) -> StereoFrame<float>;
 
     private:
         Mode _mode{Mode::Fire};
 
-        AirWindowsFireAmp<float> _fire{};
-        AirWindowsGrindAmp<float> _grind{};
+        AirWindowsFireAmp<StereoFrame<float>> _fire{};
+        AirWindowsGrindAmp<StereoFrame<float>> _grind{};
     };
 
     DynamicSmoothing<float> _gainKnob{};
@@ -73,7 +75,7 @@ private:
     DynamicSmoothing<float> _outputCV{};
     DynamicSmoothing<float> _mixCV{};
 
-    etl::array<Channel, 2> _channels{};
+    Channel _channel{};
 };
 
 }  // namespace grit
@@ -1,14 +1,14 @@
 #include "poseidon.hpp"
 
+#include <grit/core/profile.hpp>
+
 namespace grit {
 
 auto Poseidon::nextTextureAlgorithm() -> void {}
 
 auto Poseidon::nextDistortionAlgorithm() -> void
 {
-    for (auto& channel : _channels) {
-        channel.nextDistortionAlgorithm();
-    }
+    _channel.nextDistortionAlgorithm();
 }
 
 auto Poseidon::prepare(float sampleRate, etl::size_t blockSize) -> void
@@ -24,12 +24,13 @@ auto Poseidon::prepare(float sampleRate, etl::size_t blockSize) -> void
     _attackCv.setSampleRate(blockRate);
     _releaseCv.setSampleRate(blockRate);
 
-    _channels[0].setSampleRate(sampleRate);
-    _channels[1].setSampleRate(sampleRate);
+    _channel.setSampleRate(sampleRate);
 }
 
 auto Poseidon::process(StereoBlock<float> const& buffer, ControlInput const& inputs) -> ControlOutput
 {
+    GRIT_PROFILE_ZONE("Poseidon::process");
+
     auto const textureKnob    = _textureKnob(inputs.textureKnob);
     auto const morphKnob      = _morphKnob(inputs.morphKnob);
     auto const ampKnob        = _ampKnob(inputs.ampKnob);
@@ -49,19 +50,16 @@ auto Poseidon::process(StereoBlock<float> const& buffer, ControlInput const& inp
         .release    = releaseCv,
     };
 
-    for (auto& channel : _channels) {
-        channel.setParameter(channelParameter);
-    }
+    _channel.setParameter(channelParameter);
 
     auto env = 0.0F;
     for (auto i = size_t(0); i < buffer.extent(1); ++i) {
-        auto const [left, envLeft]   = etl::invoke(_channels[0], buffer(0, i));
-        auto const [right, envRight] = etl::invoke(_channels[1], buffer(1, i));
+        auto const [out, envelope] = _channel({buffer(0, i), buffer(1, i)});
 
-        env = (envLeft + envRight) * 0.5F;
+        env = (envelope.left + envelope.right) * 0.5F;
 
-        buffer(0, i) = left;
-        buffer(1, i) = right;
+        buffer(0, i) = out.left;
+        buffer(1, i) = out.right;
     }
 
     // "DIGITAL" GATE LOGIC
@@ -88,19 +86,19 @@ auto Poseidon::Amp::setSampleRate(float sampleRate) -> void
     _grindAmp.setSampleRate(sampleRate);
 }
 
-auto Poseidon::Amp::operator()(float sample) -> float
+auto Poseidon::Amp::operator()(StereoFrame<float> frame) -> StereoFrame<float>
 {
     switch (_index) {
-        case TanhIndex: return _tanh(sample);
-        case HardIndex: return _hard(sample);
-        case FullWaveIndex: return _fullWave(sample);
-        case HalfWaveIndex: return _halfWave(sample);
-        case DiodeIndex: return _diode(sample);
-        case FireAmpIndex: return _fireAmp(sample);
-        case GrindAmpIndex: return _grindAmp(sample);
+        case TanhIndex: return _tanh(frame);
+        case HardIndex: return _hard(frame);
+        case FullWaveIndex: return _fullWave(frame);
+        case HalfWaveIndex: return _halfWave(frame);
+        case DiodeIndex: return _diode(frame);
+        case FireAmpIndex: return _fireAmp(frame);
+        case GrindAmpIndex: return _grindAmp(frame);
         default: break;
     }
-    return sample;
+    return frame;
 }
 
 auto Poseidon::Channel::setParameter(Parameter const& parameter) -> void
@@ -115,13 +113,15 @@ auto Poseidon::Channel::setParameter(Parameter const& parameter) -> void
         .release = release,
     });
 
-    _compressor.setParameter({
-        .threshold = Decibels<float>{remap(parameter.compressor, -6.0F, -12.0F)},
-        .knee      = Decibels<float>{2.0F},
-        .ratio     = remap(parameter.compressor, +1.0F, +8.0F),
-        .attack    = attack,
-        .release   = release,
-    });
+    for (auto& compressor : _compressors) {
+        compressor.setParameter({
+            .threshold = Decibels<float>{remap(parameter.compressor, -6.0F, -12.0F)},
+            .knee      = Decibels<float>{2.0F},
+            .ratio     = remap(parameter.compressor, +1.0F, +8.0F),
+            .attack    = attack,
+            .release   = release,
+        });
+    }
 }
 
 auto Poseidon::Channel::nextDistortionAlgorithm() -> void { _distortion.next(); }
@@ -129,14 +129,15 @@ auto Poseidon::Channel::nextDistortionAlgorithm() -> void { _distortion.next();
 auto Poseidon::Channel::setSampleRate(float sampleRate) -> void
 {
     _envelope.setSampleRate(sampleRate);
-    _compressor.setSampleRate(sampleRate);
+    _compressors[0].setSampleRate(sampleRate);
+    _compressors[1].setSampleRate(sampleRate);
     _distortion.setSampleRate(sampleRate);
 }
 
-auto Poseidon::Channel::operator()(float sample) -> etl::pair<float, float>
+auto Poseidon::Channel::operator()(StereoFrame<float> frame) -> etl::pair<StereoFrame<float>, StereoFrame<float>>
 {
-    auto const env     = _envelope(sample);
-    auto const texture = etl::clamp(env + _parameter.texture, 0.0F, 1.0F);
+    auto const env     = GRIT_PROFILE_EXPR("Poseidon::envelope", _envelope(frame));
+    auto const texture = laneClamp(env + _parameter.texture, 0.0F, 1.0F);
 
     // _vinyl.setDeRez(texture);
     // auto const vinyl = _vinyl(sample);
@@ -146,8 +147,15 @@ auto Poseidon::Channel::operator()(float sample) -> etl::pair<float, float>
     // auto const mixed = (noise * mix) + (vinyl * (1.0F - mix));
 
     auto const drive   = remap(_parameter.amp, 1.0F, 8.0F);  // +18dB
-    auto const distOut = _distortion((sample + noise) * drive);
-    return {_compressor(distOut, distOut), env};
+    auto const distOut = GRIT_PROFILE_EXPR("Poseidon::amp", _distortion((frame + noise) * drive));
+    auto const out     = GRIT_PROFILE_EXPR(
+        "Poseidon::compressor",
+        (StereoFrame<float>{
+            _compressors[0](distOut.left, distOut.left),
+            _compressors[1](distOut.right, distOut.right),
+        })
+    );
+    return {out, env};
 }
 
 }  // namespace grit
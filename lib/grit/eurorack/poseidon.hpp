@@ -8,7 +8,9 @@
 #include <grit/audio/filter/dynamic_smoothing.hpp>
 #include <grit/audio/mix/cross_fade.hpp>
 #include <grit/audio/noise/white_noise.hpp>
+#include <grit/audio/stereo/lane.hpp>
 #include <grit/audio/stereo/stereo_block.hpp>
+#include <grit/audio/stereo/stereo_frame.hpp>
 #include <grit/audio/waveshape/diode_rectifier.hpp>
 #include <grit/audio/waveshape/full_wave_rectifier.hpp>
 #include <grit/audio/waveshape/half_wave_rectifier.hpp>
@@ -66,7 +68,7 @@ private:
 
         auto next() -> void;
         auto setSampleRate(float sampleRate) -> void;
-        [[nodiscard]] auto operator()(float sample) -> float;
+        [[nodiscard]] auto operator()(StereoFrame<float> frame) -> StereoFrame<float>;
 
     private:
         enum Index : int
@@ -82,15 +84,17 @@ private:
         };
 
         Index _index{TanhIndex};
-        TanhClipperADAA1<float> _tanh{};
-        HardClipper<float> _hard{};
-        FullWaveRectifier<float> _fullWave{};
-        HalfWaveRectifier<float> _halfWave{};
-        DiodeRectifier<float> _diode{};
-        AirWindowsFireAmp<float> _fireAmp{42};
-        AirWindowsGrindAmp<float> _grindAmp{143};
+        TanhClipperADAA1<StereoFrame<float>> _tanh{};
+        HardClipper<StereoFrame<float>> _hard{};
+        FullWaveRectifier<StereoFrame<float>> _fullWave{};
+        HalfWaveRectifier<StereoFrame<float>> _halfWave{};
+        DiodeRectifier<StereoFrame<float>> _diode{};
+        AirWindowsFireAmp<StereoFrame<float>> _fireAmp{42};
+        AirWindowsGrindAmp<StereoFrame<float>> _grindAmp{143};
     };
 
+    /// Both channels as the lanes of a StereoFrame. Only the compressors run per
+    /// channel, their gain computer works on scalars.
     struct Channel
     {
         struct Parameter
@@ -110,7 +114,8 @@ private:
         auto nextDistortionAlgorithm() -> void;
 
         auto setSampleRate(float sampleRate) -> void;
-        [[nodiscard]] auto operator()(float sample) -> etl::pair<float, float>;
+        /// Returns the output & the envelope of both channels.
+        [[nodiscard]] auto operator()(StereoFrame<float> frame) -> etl::pair<StereoFrame<float>, StereoFrame<float>>;
 
     private:
         static constexpr auto attackRange  = NormalizableRange<float>{1.0F, 100.0F, 25.0F};
@@ -118,11 +123,11 @@ private:
 
         Parameter _parameter{};
 
-        EnvelopeFollower<float> _envelope{};
+        EnvelopeFollower<StereoFrame<float>> _envelope{};
         WhiteNoise<float> _whiteNoise{};
         AirWindowsVinylDither<float> _vinyl{};
         Amp _distortion{};
-        SoftKneeCompressor<float> _compressor{};
+        etl::array<SoftKneeCompressor<float>, 2> _compressors{};
     };
 
     DynamicSmoothing<float> _textureKnob{};
@@ -134,7 +139,7 @@ private:
     DynamicSmoothing<float> _attackCv{};
     DynamicSmoothing<float> _releaseCv{};
 
-    etl::array<Channel, 2> _channels{};
+    Channel _channel{};
 };
 
 }  // namespace grit
@@ -5,3 +5,13 @@
 #include <grit/fft/bitrevorder.hpp>
 #include <grit/fft/direction.hpp>
 #include <grit/fft/fft.hpp>
+#include <grit/fft/goertzel_bank.hpp>
+#include <grit/fft/sliding_dft.hpp>
+#include <grit/fft/static_batched_plan.hpp>
+#include <grit/fft/static_mixed_radix_plan.hpp>
+#include <grit/fft/static_q15_plan.hpp>
+#include <grit/fft/static_real_plan.hpp>
+#include <grit/fft/static_split_plan.hpp>
+#include <grit/fft/static_stereo_real_plan.hpp>
+#include <grit/fft/stft.hpp>
+#include <grit/fft/window.hpp>
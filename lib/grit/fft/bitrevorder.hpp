@@ -12,6 +12,25 @@
 
 namespace grit::fft {
 
+namespace detail {
+
+template<etl::size_t Size>
+[[nodiscard]] constexpr auto makeBitrevorderTable() -> etl::array<etl::smallest_size_t<Size>, Size>
+{
+    using Index = etl::smallest_size_t<Size>;
+
+    auto const order = ilog2(Size);
+    auto table       = etl::array<Index, Size>{};
+    for (auto i{0U}; i < Size; ++i) {
+        for (auto j{0U}; j < order; ++j) {
+            table[i] |= static_cast<Index>(((i >> j) & 1) << (order - 1 - j));
+        }
+    }
+    return table;
+}
+
+}  // namespace detail
+
 /// \ingroup grit-fft
 template<etl::size_t Size>
     requires(etl::has_single_bit(Size))
@@ -22,30 +41,45 @@ struct StaticBitrevorderPlan
     template<etl::linalg::inout_vector Vec>
     auto operator()(Vec x) -> void
     {
-        for (auto i{0U}; i < _table.size(); ++i) {
-            auto const j = static_cast<typename Vec::index_type>(_table[i]);
+        for (auto i{0U}; i < table.size(); ++i) {
+            auto const j = static_cast<typename Vec::index_type>(table[i]);
             if (i < j) {
                 etl::swap(x(i), x(j));
             }
         }
     }
 
-private:
-    using index_type = etl::smallest_size_t<Size>;
+    /// Reorders the first 2^order elements of x, reusing the max-size table.
+    template<etl::linalg::inout_vector Vec>
+    auto operator()(Vec x, etl::size_t order) -> void
+    {
+        auto const shift = ilog2(Size) - order;
+        auto const size  = etl::size_t(1) << order;
 
-    [[nodiscard]] static constexpr auto make() -> etl::array<index_type, Size>
+        for (auto i{0U}; i < size; ++i) {
+            auto const j = static_cast<typename Vec::index_type>(table[i] >> shift);
+            if (i < j) {
+                etl::swap(x(i), x(j));
+            }
+        }
+    }
+
+    /// Reorders every row of x (channel, index), walking the table only once.
+    template<etl::linalg::inout_matrix Mat>
+    auto operator()(Mat x) -> void
     {
-        auto const order = ilog2(Size);
-        auto table       = etl::array<index_type, Size>{};
-        for (auto i{0U}; i < Size; ++i) {
-            for (auto j{0U}; j < order; ++j) {
-                table[i] |= ((i >> j) & 1) << (order - 1 - j);
+        for (auto i{0U}; i < table.size(); ++i) {
+            auto const j = static_cast<typename Mat::index_type>(table[i]);
+            if (i < j) {
+                for (auto ch{0U}; ch < x.extent(0); ++ch) {
+                    etl::swap(x(ch, i), x(ch, j));
+                }
             }
         }
-        return table;
     }
 
-    etl::array<index_type, Size> _table{make()};
+private:
+    static constexpr auto table = detail::makeBitrevorderTable<Size>();
 };
 
 }  // namespace grit::fft
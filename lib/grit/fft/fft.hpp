@@ -20,14 +20,45 @@ namespace grit::fft {
 
 namespace detail {
 
+/// Returns e^(-2 pi i k / n) for the forward and e^(+2 pi i k / n) for the
+/// backward direction. Usable in constant expressions: The angle is reduced to
+/// the first quadrant with integer math and evaluated with a double precision
+/// taylor series, so the quarter turns are exact.
+template<typename Float>
+[[nodiscard]] constexpr auto twiddle(etl::size_t k, etl::size_t n, Direction dir) -> etl::complex<Float>
+{
+    k %= n;
+
+    auto const quadrant  = (k * 4) / n;
+    auto const remainder = k * 4 - quadrant * n;
+    auto const x         = etl::numbers::pi * 0.5 * static_cast<double>(remainder) / static_cast<double>(n);
+
+    auto sin  = 0.0;
+    auto cos  = 0.0;
+    auto term = 1.0;
+    for (auto i{0}; i < 24; ++i) {
+        switch (i % 4) {
+            case 0: cos += term; break;
+            case 1: sin += term; break;
+            case 2: cos -= term; break;
+            default: sin -= term; break;
+        }
+        term *= x / static_cast<double>(i + 1);
+    }
+
+    auto const re   = etl::array{cos, -sin, -cos, sin}[quadrant];
+    auto const im   = etl::array{sin, cos, -sin, -cos}[quadrant];
+    auto const sign = dir == Direction::Forward ? -1.0 : 1.0;
+    return etl::complex<Float>{static_cast<Float>(re), static_cast<Float>(sign * im)};
+}
+
 template<typename Float, unsigned Size>
-auto makeTwiddles(Direction dir = Direction::Forward) -> etl::array<etl::complex<Float>, Size / 2>
+[[nodiscard]] constexpr auto makeTwiddles(Direction dir = Direction::Forward)
+    -> etl::array<etl::complex<Float>, Size / 2>
 {
-    auto const sign = dir == Direction::Forward ? Float(-1) : Float(1);
-    auto table      = etl::array<etl::complex<Float>, Size / 2>{};
+    auto table = etl::array<etl::complex<Float>, Size / 2>{};
     for (unsigned i = 0; i < Size / 2; ++i) {
-        auto const angle = sign * Float(2) * static_cast<Float>(etl::numbers::pi) * Float(i) / Float(Size);
-        table[i]         = etl::polar(Float(1), angle);
+        table[i] = twiddle<Float>(i, Size, dir);
     }
     return table;
 }
@@ -126,6 +157,110 @@ template<int Stage, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector I
     }
 }
 
+/// Fuses the radix-2 stages Stage and Stage+1 into one radix-4 pass with trivial twiddles (first stage)
+template<int Stage, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    requires(Stage == 0)
+[[gnu::noinline]] auto staticDit4StageV2(InOutVec x, InVec w, int order) -> void
+{
+    using Complex = typename InOutVec::value_type;
+
+    auto const size = 1 << order;
+    auto const sign = w(size / 4).imag();
+
+    for (auto k{0}; k < size; k += 4) {
+        auto const a0 = x(k + 0);
+        auto const a1 = x(k + 1);
+        auto const a2 = x(k + 2);
+        auto const a3 = x(k + 3);
+
+        auto const s01 = a0 + a1;
+        auto const d01 = a0 - a1;
+        auto const s23 = a2 + a3;
+        auto const d23 = a2 - a3;
+        auto const r23 = Complex{-sign * d23.imag(), sign * d23.real()};
+
+        x(k + 0) = s01 + s23;
+        x(k + 1) = d01 + r23;
+        x(k + 2) = s01 - s23;
+        x(k + 3) = d01 - r23;
+    }
+}
+
+/// Fuses the radix-2 stages Stage and Stage+1 into one radix-4 pass
+template<int Stage, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    requires(Stage != 0)
+[[gnu::noinline]] auto staticDit4StageV2(InOutVec x, InVec w, int order) -> void
+{
+    using Complex = typename InOutVec::value_type;
+
+    static constexpr auto const quarter = ipow<2>(Stage);
+    static constexpr auto const stride  = quarter * 4;
+
+    auto const size     = 1 << order;
+    auto const half     = size / 2;
+    auto const twStride = size / stride;
+    auto const sign     = w(size / 4).imag();
+
+    auto const butterfly = [x, sign](int i, Complex t1, Complex t2, Complex t3) {
+        auto const a0 = x(i);
+        auto const a1 = t2 * x(i + quarter);
+        auto const a2 = t1 * x(i + quarter * 2);
+        auto const a3 = t3 * x(i + quarter * 3);
+
+        auto const s01 = a0 + a1;
+        auto const d01 = a0 - a1;
+        auto const s23 = a2 + a3;
+        auto const d23 = a2 - a3;
+        auto const r23 = Complex{-sign * d23.imag(), sign * d23.real()};
+
+        x(i)               = s01 + s23;
+        x(i + quarter)     = d01 + r23;
+        x(i + quarter * 2) = s01 - s23;
+        x(i + quarter * 3) = d01 - r23;
+    };
+
+    for (auto k{0}; k < size; k += stride) {
+        auto const one = Complex{1, 0};
+        butterfly(k, one, one, one);
+
+        for (auto pair{1}; pair < quarter; ++pair) {
+            // W^3j wraps past the end of the half-size table: W^(j+N/2) = -W^j
+            auto const i3 = pair * twStride * 3;
+            auto const t3 = i3 < half ? w(i3) : -w(i3 - half);
+            butterfly(k + pair, w(pair * twStride), w(pair * twStride * 2), t3);
+        }
+    }
+}
+
+template<int Order, int Stage, etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec>
+auto staticStockhamStage(InVec x, OutVec y, etl::linalg::in_vector auto w) -> void
+{
+    static constexpr auto const stride = ipow<2>(Stage);
+    static constexpr auto const half   = ipow<2>(Order - Stage - 1);
+
+    for (auto p{0}; p < half; ++p) {
+        auto const tw = w(p * stride);
+
+        for (auto q{0}; q < stride; ++q) {
+            auto const a = x(q + stride * p);
+            auto const b = x(q + stride * (p + half));
+
+            y(q + stride * (2 * p))     = a + b;
+            y(q + stride * (2 * p + 1)) = (a - b) * tw;
+        }
+    }
+}
+
+template<int Order, int Stage, etl::linalg::inout_vector Vec, etl::linalg::inout_vector Scratch>
+auto staticStockhamPass(Vec x, Scratch y, etl::linalg::in_vector auto w) -> void
+{
+    if constexpr (Stage % 2 == 0) {
+        staticStockhamStage<Order, Stage>(x, y, w);
+    } else {
+        staticStockhamStage<Order, Stage>(y, x, w);
+    }
+}
+
 }  // namespace detail
 
 /// \ingroup grit-fft
@@ -135,10 +270,7 @@ struct StaticComplexPlan
     using ValueType = Complex;
     using SizeType  = etl::size_t;
 
-    explicit StaticComplexPlan(Direction defaultDirection = Direction::Forward)
-        : _defaultDirection{defaultDirection}
-        , _w{detail::makeTwiddles<typename Complex::value_type, size()>(defaultDirection)}
-    {}
+    StaticComplexPlan() = default;
 
     [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
 
@@ -150,9 +282,9 @@ struct StaticComplexPlan
     {
         _reorder(x);
 
-        auto const w = etl::mdspan<Complex, etl::extents<etl::size_t, size()>>{_w.data()};
+        auto const w = etl::mdspan<Complex const, etl::extents<etl::size_t, size() / 2>>{twiddles.data()};
 
-        if (dir == _defaultDirection) {
+        if (dir == Direction::Forward) {
             detail::ComplexDit2Stage<Complex, order(), 0>{}(x, w);
         } else {
             detail::ComplexDit2Stage<Complex, order(), 0>{}(x, etl::linalg::conjugated(w));
@@ -160,9 +292,9 @@ struct StaticComplexPlan
     }
 
 private:
-    Direction _defaultDirection;
-    StaticBitrevorderPlan<size()> _reorder{};
-    etl::array<Complex, size() / 2> _w;
+    static constexpr auto twiddles = detail::makeTwiddles<typename Complex::value_type, Size>();
+
+    StaticBitrevorderPlan<Size> _reorder{};
 };
 
 /// \ingroup grit-fft
@@ -172,10 +304,7 @@ struct StaticComplexPlanV2
     using ValueType = Complex;
     using SizeType  = etl::size_t;
 
-    explicit StaticComplexPlanV2(Direction defaultDirection = Direction::Forward)
-        : _defaultDirection{defaultDirection}
-        , _w{detail::makeTwiddles<typename Complex::value_type, size()>(defaultDirection)}
-    {}
+    StaticComplexPlanV2() = default;
 
     [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
 
@@ -191,9 +320,9 @@ struct StaticComplexPlanV2
 
         _reorder(x);
 
-        auto const w = etl::mdspan<Complex, etl::extents<etl::size_t, size()>>{_w.data()};
+        auto const w = etl::mdspan<Complex const, etl::extents<etl::size_t, size() / 2>>{twiddles.data()};
 
-        if (dir == _defaultDirection) {
+        if (dir == Direction::Forward) {
             runStages(etl::make_index_sequence<order()>(), w);
         } else {
             runStages(etl::make_index_sequence<order()>(), etl::linalg::conjugated(w));
@@ -201,9 +330,187 @@ struct StaticComplexPlanV2
     }
 
 private:
-    Direction _defaultDirection;
-    StaticBitrevorderPlan<size()> _reorder{};
-    etl::array<Complex, size() / 2> _w;
+    static constexpr auto twiddles = detail::makeTwiddles<typename Complex::value_type, Size>();
+
+    StaticBitrevorderPlan<Size> _reorder{};
+};
+
+/// \brief Radix-2 Stockham autosort FFT.
+/// \details Out-of-place ping-pong between the input and an internal scratch
+/// buffer. Each stage reads and writes both buffers sequentially and the output
+/// is naturally ordered, so no bit-reversal pass is required.
+/// \ingroup grit-fft
+template<typename Complex, etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 2)
+struct StaticStockhamPlan
+{
+    using ValueType = Complex;
+    using SizeType  = etl::size_t;
+
+    StaticStockhamPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    template<etl::linalg::inout_vector InOutVec>
+        requires etl::same_as<typename InOutVec::value_type, Complex>
+    auto operator()(InOutVec x, Direction dir) -> void
+    {
+        auto const y = etl::mdspan<Complex, etl::extents<etl::size_t, size()>>{_scratch.data()};
+
+        auto runStages = [x, y]<etl::size_t... Stage>(etl::index_sequence<Stage...>, etl::linalg::in_vector auto w) {
+            (detail::staticStockhamPass<order(), Stage>(x, y, w), ...);
+        };
+
+        auto const w = etl::mdspan<Complex const, etl::extents<etl::size_t, size() / 2>>{twiddles.data()};
+
+        if (dir == Direction::Forward) {
+            runStages(etl::make_index_sequence<order()>(), w);
+        } else {
+            runStages(etl::make_index_sequence<order()>(), etl::linalg::conjugated(w));
+        }
+
+        if constexpr (order() % 2 == 1) {
+            etl::linalg::copy(y, x);
+        }
+    }
+
+private:
+    static constexpr auto twiddles = detail::makeTwiddles<typename Complex::value_type, Size>();
+
+    etl::array<Complex, Size> _scratch{};
+};
+
+/// \brief Radix-4 decimation in time FFT.
+/// \details Same in-place bit-reversed layout as StaticComplexPlanV2, but pairs
+/// of radix-2 stages are fused into radix-4 passes. This halves the number of
+/// passes over the buffer and saves a quarter of the twiddle multiplies. The
+/// first pass only uses trivial twiddles (1, -j) and is special-cased.
+/// \ingroup grit-fft
+template<typename Complex, etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 2)
+struct StaticRadix4Plan
+{
+    using ValueType = Complex;
+    using SizeType  = etl::size_t;
+
+    StaticRadix4Plan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    template<etl::linalg::inout_vector InOutVec>
+        requires etl::same_as<typename InOutVec::value_type, Complex>
+    auto operator()(InOutVec x, Direction dir) -> void
+    {
+        static constexpr auto const first = static_cast<int>(order() % 2);
+
+        auto runStages = [x]<etl::size_t... Stage>(etl::index_sequence<Stage...>, etl::linalg::in_vector auto w) {
+            if constexpr (first == 1) {
+                detail::staticDit2StageV2<0>(x, w, order());
+            }
+            (detail::staticDit4StageV2<first + static_cast<int>(Stage) * 2>(x, w, order()), ...);
+        };
+
+        _reorder(x);
+
+        auto const w = etl::mdspan<Complex const, etl::extents<etl::size_t, size() / 2>>{twiddles.data()};
+
+        if (dir == Direction::Forward) {
+            runStages(etl::make_index_sequence<order() / 2>(), w);
+        } else {
+            runStages(etl::make_index_sequence<order() / 2>(), etl::linalg::conjugated(w));
+        }
+    }
+
+private:
+    static constexpr auto twiddles = detail::makeTwiddles<typename Complex::value_type, Size>();
+
+    StaticBitrevorderPlan<Size> _reorder{};
+};
+
+/// \brief Radix-2 FFT with a runtime selectable size.
+/// \details The transform size can be changed with setOrder at any time up to
+/// MaxSize. All sizes share a single max-size twiddle and bit-reversal table,
+/// which is indexed with a stride of MaxSize / size(), so switching the
+/// resolution does not allocate or recompute anything.
+/// \ingroup grit-fft
+template<typename Complex, etl::size_t MaxSize>
+    requires(etl::has_single_bit(MaxSize) and MaxSize >= 2)
+struct ComplexPlan
+{
+    using ValueType = Complex;
+    using SizeType  = etl::size_t;
+
+    ComplexPlan() = default;
+
+    [[nodiscard]] static constexpr auto maxSize() -> etl::size_t { return MaxSize; }
+
+    [[nodiscard]] static constexpr auto maxOrder() -> etl::size_t { return ilog2(MaxSize); }
+
+    [[nodiscard]] auto size() const -> etl::size_t { return etl::size_t(1) << _order; }
+
+    [[nodiscard]] auto order() const -> etl::size_t { return _order; }
+
+    /// Sets the transform size to 2^order. Clamped to [1, maxOrder()].
+    auto setOrder(etl::size_t order) -> void { _order = etl::clamp<etl::size_t>(order, 1, maxOrder()); }
+
+    /// Transforms the first size() elements of x in-place.
+    template<etl::linalg::inout_vector InOutVec>
+        requires etl::same_as<typename InOutVec::value_type, Complex>
+    auto operator()(InOutVec x, Direction dir) -> void
+    {
+        _reorder(x, _order);
+
+        auto const w = etl::mdspan<Complex const, etl::extents<etl::size_t, maxSize() / 2>>{twiddles.data()};
+
+        if (dir == Direction::Forward) {
+            runStages(x, w);
+        } else {
+            runStages(x, etl::linalg::conjugated(w));
+        }
+    }
+
+private:
+    template<etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+    auto runStages(InOutVec x, InVec w) const -> void
+    {
+        auto const size  = static_cast<int>(this->size());
+        auto const order = static_cast<int>(_order);
+        auto const scale = static_cast<int>(maxOrder()) - order;
+
+        for (auto k{0}; k < size; k += 2) {
+            auto const temp = x(k) + x(k + 1);
+            x(k + 1)        = x(k) - x(k + 1);
+            x(k)            = temp;
+        }
+
+        for (auto stage{1}; stage < order; ++stage) {
+            auto const stageLength = ipow<2>(stage);
+            auto const stride      = ipow<2>(stage + 1);
+            auto const twStride    = ipow<2>(order - stage - 1 + scale);
+
+            for (auto k{0}; k < size; k += stride) {
+                for (auto pair{0}; pair < stageLength; ++pair) {
+                    auto const tw = w(pair * twStride);
+
+                    auto const i1 = k + pair;
+                    auto const i2 = k + pair + stageLength;
+
+                    auto const temp = x(i1) + tw * x(i2);
+                    x(i2)           = x(i1) - tw * x(i2);
+                    x(i1)           = temp;
+                }
+            }
+        }
+    }
+
+    static constexpr auto twiddles = detail::makeTwiddles<typename Complex::value_type, MaxSize>();
+
+    etl::size_t _order{maxOrder()};
+    StaticBitrevorderPlan<MaxSize> _reorder{};
 };
 
 }  // namespace grit::fft
@@ -1,7 +1,15 @@
 #include "fft.hpp"
 
+#include <etl/algorithm.hpp>
+#include <etl/cmath.hpp>
+#include <etl/complex.hpp>
+#include <etl/limits.hpp>
+#include <etl/random.hpp>
+
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_get_random_seed.hpp>
 #include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 template<typename Plan>
 auto testStaticComplexPlan() -> void
@@ -47,3 +55,180 @@ TEMPLATE_TEST_CASE("fft: StaticComplexPlanV2", "", etl::complex<float>, etl::com
     testStaticComplexPlan<grit::fft::StaticComplexPlanV2<TestType, 512>>();
     testStaticComplexPlan<grit::fft::StaticComplexPlanV2<TestType, 1024>>();
 }
+
+TEMPLATE_TEST_CASE("fft: StaticStockhamPlan", "", etl::complex<float>, etl::complex<double>)
+{
+    testStaticComplexPlan<grit::fft::StaticStockhamPlan<TestType, 2>>();
+    testStaticComplexPlan<grit::fft::StaticStockhamPlan<TestType, 64>>();
+    testStaticComplexPlan<grit::fft::StaticStockhamPlan<TestType, 128>>();
+    testStaticComplexPlan<grit::fft::StaticStockhamPlan<TestType, 256>>();
+    testStaticComplexPlan<grit::fft::StaticStockhamPlan<TestType, 512>>();
+    testStaticComplexPlan<grit::fft::StaticStockhamPlan<TestType, 1024>>();
+}
+
+template<typename Plan, typename ReferencePlan>
+auto testMatchesReferencePlan() -> void
+{
+    using Complex = typename Plan::ValueType;
+    using Float   = typename Complex::value_type;
+
+    static_assert(Plan::size() == ReferencePlan::size());
+
+    // Round-off grows with the number of stages & the magnitude of the values
+    auto const epsilon = 8.0 * static_cast<double>(etl::numeric_limits<Float>::epsilon());
+    auto const stages  = etl::max(etl::log2(static_cast<double>(Plan::size())), 1.0);
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto xBuf = etl::array<Complex, Plan::size()>{};
+    etl::generate(xBuf.begin(), xBuf.end(), [&] { return Complex{dist(rng), dist(rng)}; });
+    auto refBuf = xBuf;
+
+    auto x   = etl::mdspan{xBuf.data(), etl::extents<etl::size_t, Plan::size()>{}};
+    auto ref = etl::mdspan{refBuf.data(), etl::extents<etl::size_t, Plan::size()>{}};
+
+    auto plan    = Plan{};
+    auto refPlan = ReferencePlan{};
+
+    for (auto dir : {grit::fft::Direction::Forward, grit::fft::Direction::Backward}) {
+        plan(x, dir);
+        refPlan(ref, dir);
+
+        auto power = 0.0;
+        for (auto const& z : refBuf) {
+            power += static_cast<double>(etl::norm(z));
+        }
+
+        auto const tolerance = epsilon * stages * etl::sqrt(power / Plan::size());
+        for (auto i{0U}; i < Plan::size(); ++i) {
+            REQUIRE_THAT(xBuf[i].real(), Catch::Matchers::WithinAbs(refBuf[i].real(), tolerance));
+            REQUIRE_THAT(xBuf[i].imag(), Catch::Matchers::WithinAbs(refBuf[i].imag(), tolerance));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StaticStockhamPlan matches StaticComplexPlanV2", "", etl::complex<float>, etl::complex<double>)
+{
+    using grit::fft::StaticComplexPlanV2;
+    using grit::fft::StaticStockhamPlan;
+
+    testMatchesReferencePlan<StaticStockhamPlan<TestType, 2>, StaticComplexPlanV2<TestType, 2>>();
+    testMatchesReferencePlan<StaticStockhamPlan<TestType, 8>, StaticComplexPlanV2<TestType, 8>>();
+    testMatchesReferencePlan<StaticStockhamPlan<TestType, 64>, StaticComplexPlanV2<TestType, 64>>();
+    testMatchesReferencePlan<StaticStockhamPlan<TestType, 512>, StaticComplexPlanV2<TestType, 512>>();
+    testMatchesReferencePlan<StaticStockhamPlan<TestType, 1024>, StaticComplexPlanV2<TestType, 1024>>();
+}
+
+TEMPLATE_TEST_CASE("fft: StaticRadix4Plan", "", etl::complex<float>, etl::complex<double>)
+{
+    testStaticComplexPlan<grit::fft::StaticRadix4Plan<TestType, 2>>();
+    testStaticComplexPlan<grit::fft::StaticRadix4Plan<TestType, 4>>();
+    testStaticComplexPlan<grit::fft::StaticRadix4Plan<TestType, 64>>();
+    testStaticComplexPlan<grit::fft::StaticRadix4Plan<TestType, 128>>();
+    testStaticComplexPlan<grit::fft::StaticRadix4Plan<TestType, 256>>();
+    testStaticComplexPlan<grit::fft::StaticRadix4Plan<TestType, 512>>();
+    testStaticComplexPlan<grit::fft::StaticRadix4Plan<TestType, 1024>>();
+}
+
+TEMPLATE_TEST_CASE("fft: StaticRadix4Plan matches StaticComplexPlanV2", "", etl::complex<float>, etl::complex<double>)
+{
+    using grit::fft::StaticComplexPlanV2;
+    using grit::fft::StaticRadix4Plan;
+
+    testMatchesReferencePlan<StaticRadix4Plan<TestType, 2>, StaticComplexPlanV2<TestType, 2>>();
+    testMatchesReferencePlan<StaticRadix4Plan<TestType, 4>, StaticComplexPlanV2<TestType, 4>>();
+    testMatchesReferencePlan<StaticRadix4Plan<TestType, 8>, StaticComplexPlanV2<TestType, 8>>();
+    testMatchesReferencePlan<StaticRadix4Plan<TestType, 16>, StaticComplexPlanV2<TestType, 16>>();
+    testMatchesReferencePlan<StaticRadix4Plan<TestType, 128>, StaticComplexPlanV2<TestType, 128>>();
+    testMatchesReferencePlan<StaticRadix4Plan<TestType, 256>, StaticComplexPlanV2<TestType, 256>>();
+    testMatchesReferencePlan<StaticRadix4Plan<TestType, 2048>, StaticComplexPlanV2<TestType, 2048>>();
+}
+
+TEMPLATE_TEST_CASE("fft: ComplexPlan", "", etl::complex<float>, etl::complex<double>)
+{
+    using Complex = TestType;
+    using Float   = typename Complex::value_type;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto plan = grit::fft::ComplexPlan<Complex, 1024>{};
+    STATIC_REQUIRE(plan.maxSize() == 1024);
+    STATIC_REQUIRE(plan.maxOrder() == 10);
+    REQUIRE(plan.size() == 1024);
+
+    plan.setOrder(0);
+    REQUIRE(plan.order() == 1);
+    plan.setOrder(42);
+    REQUIRE(plan.order() == 10);
+
+    auto check = [&]<etl::size_t Size>(grit::fft::StaticComplexPlanV2<Complex, Size> refPlan) {
+        plan.setOrder(grit::ilog2(Size));
+        REQUIRE(plan.size() == Size);
+
+        auto xBuf = etl::array<Complex, Size>{};
+        etl::generate(xBuf.begin(), xBuf.end(), [&] { return Complex{dist(rng), dist(rng)}; });
+        auto refBuf = xBuf;
+
+        auto x   = etl::mdspan{xBuf.data(), etl::extents<etl::size_t, Size>{}};
+        auto ref = etl::mdspan{refBuf.data(), etl::extents<etl::size_t, Size>{}};
+
+        for (auto dir : {grit::fft::Direction::Forward, grit::fft::Direction::Backward}) {
+            plan(x, dir);
+            refPlan(ref, dir);
+
+            for (auto i{0U}; i < Size; ++i) {
+                REQUIRE_THAT(xBuf[i].real(), Catch::Matchers::WithinAbs(refBuf[i].real(), tolerance * Size));
+                REQUIRE_THAT(xBuf[i].imag(), Catch::Matchers::WithinAbs(refBuf[i].imag(), tolerance * Size));
+            }
+        }
+    };
+
+    check(grit::fft::StaticComplexPlanV2<Complex, 1024>{});
+    check(grit::fft::StaticComplexPlanV2<Complex, 2>{});
+    check(grit::fft::StaticComplexPlanV2<Complex, 64>{});
+    check(grit::fft::StaticComplexPlanV2<Complex, 256>{});
+    check(grit::fft::StaticComplexPlanV2<Complex, 8>{});
+    check(grit::fft::StaticComplexPlanV2<Complex, 512>{});
+}
+
+TEMPLATE_TEST_CASE("fft: makeTwiddles is constexpr", "", float, double)
+{
+    using Float = TestType;
+
+    static constexpr auto forward  = grit::fft::detail::makeTwiddles<Float, 8>();
+    static constexpr auto backward = grit::fft::detail::makeTwiddles<Float, 8>(grit::fft::Direction::Backward);
+    STATIC_REQUIRE(forward.size() == 4);
+    STATIC_REQUIRE(forward[0].real() == Float(1));
+    STATIC_REQUIRE(forward[0].imag() == Float(0));
+    STATIC_REQUIRE(forward[2].real() == Float(0));
+    STATIC_REQUIRE(forward[2].imag() == Float(-1));
+    STATIC_REQUIRE(backward[2].imag() == Float(1));
+
+    static constexpr auto large = grit::fft::detail::makeTwiddles<Float, 4096>();
+    for (auto i{0U}; i < large.size(); ++i) {
+        auto const angle = -2.0 * etl::numbers::pi * double(i) / 4096.0;
+        REQUIRE_THAT(large[i].real(), Catch::Matchers::WithinAbs(etl::cos(angle), 1e-7));
+        REQUIRE_THAT(large[i].imag(), Catch::Matchers::WithinAbs(etl::sin(angle), 1e-7));
+    }
+}
+
+TEST_CASE("fft: makeBitrevorderTable is constexpr")
+{
+    static constexpr auto table = grit::fft::detail::makeBitrevorderTable<8>();
+    STATIC_REQUIRE(table[0] == 0);
+    STATIC_REQUIRE(table[1] == 4);
+    STATIC_REQUIRE(table[2] == 2);
+    STATIC_REQUIRE(table[3] == 6);
+    STATIC_REQUIRE(table[4] == 1);
+    STATIC_REQUIRE(table[5] == 5);
+    STATIC_REQUIRE(table[6] == 3);
+    STATIC_REQUIRE(table[7] == 7);
+
+    static constexpr auto large = grit::fft::detail::makeBitrevorderTable<4096>();
+    STATIC_REQUIRE(large[1] == 2048);
+    STATIC_REQUIRE(large[4095] == 4095);
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/linalg.hpp>
+#include <etl/numbers.hpp>
+
+namespace grit::fft {
+
+/// \brief Bank of Goertzel filters, evaluates NumBins bins over blocks of Size samples.
+///
+/// \details Every sample costs one real multiply-add per bin. After each block
+/// of Size samples the complex bin values are computed and the filters are
+/// reset. Unlike a DFT, bins may be fractional (e.g. 10.5), so arbitrary
+/// frequencies can be tracked without zero-padding.
+///
+/// Input is a (channel, index) matrix, e.g. a StereoBlock.
+///
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels = 2>
+struct GoertzelBank
+{
+    using SampleType  = Float;
+    using ComplexType = etl::complex<Float>;
+
+    struct Parameter
+    {
+        /// Frequency in bins: k / Size cycles per sample. Bins wrap around at
+        /// Size, bin k + Size is the same frequency as bin k
+        etl::array<Float, NumBins> bins{};
+    };
+
+    GoertzelBank() { setParameter(Parameter{}); }
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto numBins() -> etl::size_t { return NumBins; }
+
+    auto setParameter(Parameter const& parameter) -> void;
+
+    auto reset() -> void;
+
+    /// Returns true, if at least one block was completed and the bins have been updated.
+    template<etl::linalg::in_matrix InMat>
+    auto operator()(InMat input) -> bool;
+
+    /// Bin of the last completed block
+    [[nodiscard]] auto bin(etl::size_t channel, etl::size_t index) const -> ComplexType;
+
+private:
+    auto finishBlock() -> void;
+
+    Parameter _parameter{};
+    etl::array<Float, NumBins> _coef{};
+    etl::array<ComplexType, NumBins> _outCoef1{};
+    etl::array<ComplexType, NumBins> _outCoef2{};
+
+    etl::size_t _pos{0};
+    etl::array<etl::array<Float, NumBins>, Channels> _s1{};
+    etl::array<etl::array<Float, NumBins>, Channels> _s2{};
+    etl::array<etl::array<ComplexType, NumBins>, Channels> _bins{};
+};
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+auto GoertzelBank<Float, Size, NumBins, Channels>::setParameter(Parameter const& parameter) -> void
+{
+    static constexpr auto twoPi = static_cast<Float>(etl::numbers::pi * 2.0);
+
+    _parameter = parameter;
+
+    auto const expMinusJ = [](Float phase) { return ComplexType{etl::cos(phase), -etl::sin(phase)}; };
+
+    // X = e^(-jw(N-1)) * (s1 - e^(-jw) * s2)
+    for (auto i{0U}; i < NumBins; ++i) {
+        auto const omega = twoPi * _parameter.bins[i] / Float(Size);
+        _coef[i]         = Float(2) * etl::cos(omega);
+        _outCoef1[i]     = expMinusJ(omega * Float(Size - 1));
+        _outCoef2[i]     = expMinusJ(omega * Float(Size));
+    }
+}
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+auto GoertzelBank<Float, Size, NumBins, Channels>::reset() -> void
+{
+    _pos = 0;
+    for (auto ch{0U}; ch < Channels; ++ch) {
+        etl::fill(_s1[ch].begin(), _s1[ch].end(), Float(0));
+        etl::fill(_s2[ch].begin(), _s2[ch].end(), Float(0));
+        etl::fill(_bins[ch].begin(), _bins[ch].end(), ComplexType{});
+    }
+}
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+template<etl::linalg::in_matrix InMat>
+auto GoertzelBank<Float, Size, NumBins, Channels>::operator()(InMat input) -> bool
+{
+    auto finished = false;
+
+    for (auto i{0U}; i < input.extent(1); ++i) {
+        for (auto ch{0U}; ch < Channels; ++ch) {
+            auto const x = static_cast<Float>(input(ch, i));
+            for (auto k{0U}; k < NumBins; ++k) {
+                auto const s0 = x + _coef[k] * _s1[ch][k] - _s2[ch][k];
+                _s2[ch][k]    = _s1[ch][k];
+                _s1[ch][k]    = s0;
+            }
+        }
+
+        if (++_pos == Size) {
+            finishBlock();
+            finished = true;
+        }
+    }
+
+    return finished;
+}
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+auto GoertzelBank<Float, Size, NumBins, Channels>::bin(etl::size_t channel, etl::size_t index) const -> ComplexType
+{
+    return _bins[channel][index];
+}
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+auto GoertzelBank<Float, Size, NumBins, Channels>::finishBlock() -> void
+{
+    _pos = 0;
+    for (auto ch{0U}; ch < Channels; ++ch) {
+        for (auto k{0U}; k < NumBins; ++k) {
+            _bins[ch][k] = _outCoef1[k] * _s1[ch][k] - _outCoef2[k] * _s2[ch][k];
+            _s1[ch][k]   = Float(0);
+            _s2[ch][k]   = Float(0);
+        }
+    }
+}
+
+}  // namespace grit::fft
@@ -0,0 +1,65 @@
+#include "goertzel_bank.hpp"
+
+#include <etl/cmath.hpp>
+#include <etl/numbers.hpp>
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEMPLATE_TEST_CASE("fft: GoertzelBank", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = etl::complex<double>;
+    using Bank    = grit::fft::GoertzelBank<Float, 48, 3>;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+    auto const bins      = etl::array<Float, 3>{Float(0), Float(3), Float(10.5)};
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto buf = etl::array<Float, Bank::size() * 2 * 2>{};
+    etl::generate(buf.begin(), buf.end(), [&] { return dist(rng); });
+
+    auto bank = Bank{};
+    bank.setParameter({.bins = bins});
+    bank.reset();
+
+    using Block = etl::mdspan<Float, etl::extents<etl::size_t, 2, etl::dynamic_extent>, etl::layout_left>;
+    REQUIRE_FALSE(bank(Block{buf.data(), 47}));
+    REQUIRE(bank(Block{buf.data() + 47 * 2, 2}));
+    REQUIRE_FALSE(bank(Block{buf.data() + 49 * 2, 46}));
+    REQUIRE(bank(Block{buf.data() + 95 * 2, 1}));
+
+    // naive dft of the second block, fractional bins included
+    for (auto ch{0U}; ch < 2; ++ch) {
+        for (auto b{0U}; b < bins.size(); ++b) {
+            auto expected = Complex{};
+            for (auto n{0U}; n < Bank::size(); ++n) {
+                auto const x     = static_cast<double>(buf[(Bank::size() + n) * 2 + ch]);
+                auto const phase = 2.0 * etl::numbers::pi * static_cast<double>(bins[b]) * n / Bank::size();
+                expected += x * Complex{etl::cos(phase), -etl::sin(phase)};
+            }
+
+            REQUIRE_THAT(bank.bin(ch, b).real(), Catch::Matchers::WithinAbs(expected.real(), tolerance));
+            REQUIRE_THAT(bank.bin(ch, b).imag(), Catch::Matchers::WithinAbs(expected.imag(), tolerance));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: GoertzelBank default parameter", "", float, double)
+{
+    using Float = TestType;
+    using Bank  = grit::fft::GoertzelBank<Float, 16, 1, 1>;
+
+    // Default bins track dc
+    auto bank = Bank{};
+    auto x    = etl::array<Float, 1>{Float(1)};
+    for (auto i{0U}; i < Bank::size(); ++i) {
+        bank(etl::mdspan<Float, etl::extents<etl::size_t, 1, 1>>{x.data()});
+    }
+    REQUIRE_THAT(bank.bin(0, 0).real(), Catch::Matchers::WithinAbs(16.0, 1e-3));
+    REQUIRE_THAT(bank.bin(0, 0).imag(), Catch::Matchers::WithinAbs(0.0, 1e-3));
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/linalg.hpp>
+
+namespace grit::fft {
+
+/// \brief Sliding DFT, updates NumBins bins of a Size point window every sample.
+///
+/// \details Each bin is updated with S = W^-k * (r * S + x[n] - r^N * x[n-N]),
+/// which costs O(NumBins) per sample instead of a full transform per hop. With
+/// a damping factor r of one, the bins equal the DFT of the last Size samples.
+/// Rounding errors in the recursion never decay in that case, a damping
+/// slightly below one keeps the filter stable at the cost of a slight
+/// exponential weighting of the window.
+///
+/// Input is a (channel, index) matrix, e.g. a StereoBlock.
+///
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels = 2>
+struct SlidingDft
+{
+    using SampleType  = Float;
+    using ComplexType = etl::complex<Float>;
+
+    struct Parameter
+    {
+        /// Bin indices wrap around at Size, bin k + Size is the same as bin k
+        etl::array<etl::size_t, NumBins> bins{};
+        Float damping{0.99999};
+    };
+
+    SlidingDft() { setParameter(Parameter{}); }
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto numBins() -> etl::size_t { return NumBins; }
+
+    auto setParameter(Parameter const& parameter) -> void;
+
+    auto reset() -> void;
+
+    template<etl::linalg::in_matrix InMat>
+    auto operator()(InMat input) -> void;
+
+    [[nodiscard]] auto bin(etl::size_t channel, etl::size_t index) const -> ComplexType;
+
+private:
+    Parameter _parameter{};
+    Float _dampingN{};
+    etl::array<ComplexType, NumBins> _rotation{};
+
+    etl::size_t _pos{0};
+    etl::array<etl::array<Float, Size>, Channels> _history{};
+    etl::array<etl::array<ComplexType, NumBins>, Channels> _bins{};
+};
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+auto SlidingDft<Float, Size, NumBins, Channels>::setParameter(Parameter const& parameter) -> void
+{
+    _parameter = parameter;
+
+    _dampingN = Float(1);
+    for (auto i{0U}; i < Size; ++i) {
+        _dampingN *= _parameter.damping;
+    }
+
+    for (auto i{0U}; i < NumBins; ++i) {
+        _rotation[i] = detail::twiddle<Float>(_parameter.bins[i], Size, Direction::Backward);
+    }
+}
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+auto SlidingDft<Float, Size, NumBins, Channels>::reset() -> void
+{
+    _pos = 0;
+    for (auto& history : _history) {
+        etl::fill(history.begin(), history.end(), Float(0));
+    }
+    for (auto& bins : _bins) {
+        etl::fill(bins.begin(), bins.end(), ComplexType{});
+    }
+}
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+template<etl::linalg::in_matrix InMat>
+auto SlidingDft<Float, Size, NumBins, Channels>::operator()(InMat input) -> void
+{
+    auto const r  = _parameter.damping;
+    auto const rN = _dampingN;
+
+    for (auto i{0U}; i < input.extent(1); ++i) {
+        for (auto ch{0U}; ch < Channels; ++ch) {
+            auto const x       = static_cast<Float>(input(ch, i));
+            auto const delta   = x - rN * _history[ch][_pos];
+            _history[ch][_pos] = x;
+
+            for (auto k{0U}; k < NumBins; ++k) {
+                _bins[ch][k] = _rotation[k] * (_bins[ch][k] * r + delta);
+            }
+        }
+
+        _pos = _pos + 1 == Size ? 0 : _pos + 1;
+    }
+}
+
+template<etl::floating_point Float, etl::size_t Size, etl::size_t NumBins, etl::size_t Channels>
+auto SlidingDft<Float, Size, NumBins, Channels>::bin(etl::size_t channel, etl::size_t index) const -> ComplexType
+{
+    return _bins[channel][index];
+}
+
+}  // namespace grit::fft
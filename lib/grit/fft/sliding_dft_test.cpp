@@ -0,0 +1,122 @@
+#include "sliding_dft.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEMPLATE_TEST_CASE("fft: SlidingDft", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = etl::complex<double>;
+    using Sdft    = grit::fft::SlidingDft<Float, 64, 3>;
+
+    static constexpr auto numSamples = 200;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto buf = etl::array<Float, numSamples * 2>{};
+    etl::generate(buf.begin(), buf.end(), [&] { return dist(rng); });
+
+    auto sdft = Sdft{};
+    sdft.setParameter({.bins = {0, 5, 31}, .damping = Float(1)});
+    sdft.reset();
+
+    // Odd block sizes to cross the history wrap around
+    for (auto start = etl::size_t(0); start < numSamples;) {
+        auto const count = etl::min(etl::size_t(7), numSamples - start);
+        auto const block = etl::mdspan<Float, etl::extents<etl::size_t, 2, etl::dynamic_extent>, etl::layout_left>{
+            buf.data() + start * 2,
+            count,
+        };
+        sdft(block);
+        start += count;
+    }
+
+    // dft over the last 64 samples
+    using grit::fft::Direction;
+    using grit::fft::detail::twiddle;
+
+    for (auto ch{0U}; ch < 2; ++ch) {
+        auto const bins = etl::array<etl::size_t, 3>{0, 5, 31};
+        for (auto b{0U}; b < bins.size(); ++b) {
+            auto expected = Complex{};
+            for (auto n{0U}; n < Sdft::size(); ++n) {
+                auto const x = static_cast<double>(buf[(numSamples - Sdft::size() + n) * 2 + ch]);
+                auto const w = twiddle<double>(bins[b] * n, Sdft::size(), Direction::Forward);
+                expected += x * w;
+            }
+
+            REQUIRE_THAT(sdft.bin(ch, b).real(), Catch::Matchers::WithinAbs(expected.real(), tolerance));
+            REQUIRE_THAT(sdft.bin(ch, b).imag(), Catch::Matchers::WithinAbs(expected.imag(), tolerance));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: SlidingDft damping", "", float, double)
+{
+    using Float = TestType;
+    using Sdft  = grit::fft::SlidingDft<Float, 32, 1, 1>;
+
+    auto sdft = Sdft{};
+    sdft.setParameter({.bins = {4}, .damping = Float(0.999)});
+
+    // tone on bin 4 settles to N/2 * r^age weighted magnitude
+    auto x = etl::array<Float, 1>{};
+    for (auto i{0U}; i < 10'000U; ++i) {
+        x[0] = static_cast<Float>(
+            grit::fft::detail::twiddle<double>(4 * i, Sdft::size(), grit::fft::Direction::Forward).real()
+        );
+        sdft(etl::mdspan<Float, etl::extents<etl::size_t, 1, 1>>{x.data()});
+    }
+    REQUIRE_THAT(etl::abs(sdft.bin(0, 0)), Catch::Matchers::WithinAbs(16.0, 0.5));
+
+    // silence decays towards zero
+    x[0] = Float(0);
+    for (auto i{0U}; i < 10'000U; ++i) {
+        sdft(etl::mdspan<Float, etl::extents<etl::size_t, 1, 1>>{x.data()});
+    }
+    REQUIRE_THAT(etl::abs(sdft.bin(0, 0)), Catch::Matchers::WithinAbs(0.0, 1e-6));
+}
+
+TEMPLATE_TEST_CASE("fft: SlidingDft default parameter", "", float, double)
+{
+    using Float = TestType;
+    using Sdft  = grit::fft::SlidingDft<Float, 32, 1, 1>;
+
+    // Same as setting the default parameter explicitly: dc bin with damping
+    auto sdft     = Sdft{};
+    auto expected = Sdft{};
+    expected.setParameter(typename Sdft::Parameter{});
+
+    auto x = etl::array<Float, 1>{Float(1)};
+    for (auto i{0U}; i < Sdft::size(); ++i) {
+        sdft(etl::mdspan<Float, etl::extents<etl::size_t, 1, 1>>{x.data()});
+        expected(etl::mdspan<Float, etl::extents<etl::size_t, 1, 1>>{x.data()});
+    }
+    REQUIRE(sdft.bin(0, 0) == expected.bin(0, 0));
+    REQUIRE_THAT(sdft.bin(0, 0).real(), Catch::Matchers::WithinAbs(32.0, 0.1));
+}
+
+TEMPLATE_TEST_CASE("fft: SlidingDft bins wrap around", "", float, double)
+{
+    using Float = TestType;
+    using Sdft  = grit::fft::SlidingDft<Float, 32, 2, 1>;
+
+    auto sdft = Sdft{};
+    sdft.setParameter({.bins = {5, 5 + Sdft::size()}, .damping = Float(1)});
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto x = etl::array<Float, 1>{};
+    for (auto i{0U}; i < 100U; ++i) {
+        x[0] = dist(rng);
+        sdft(etl::mdspan<Float, etl::extents<etl::size_t, 1, 1>>{x.data()});
+    }
+    REQUIRE(sdft.bin(0, 0) == sdft.bin(0, 1));
+}
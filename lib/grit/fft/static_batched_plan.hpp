@@ -0,0 +1,93 @@
+#pragma once
+
+#include <grit/fft/bitrevorder.hpp>
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+#include <grit/math/ilog2.hpp>
+#include <grit/math/ipow.hpp>
+
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/concepts.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/utility.hpp>
+
+namespace grit::fft {
+
+namespace detail {
+
+template<int Stage, etl::linalg::inout_matrix InOutMat, etl::linalg::in_vector InVec>
+auto staticBatchedDit2Stage(InOutMat x, InVec w) -> void
+{
+    static constexpr auto const stageLength = ipow<2>(Stage);
+    static constexpr auto const stride      = ipow<2>(Stage + 1);
+
+    auto const size     = static_cast<int>(x.extent(1));
+    auto const twStride = size / stride;
+
+    for (auto k{0}; k < size; k += stride) {
+        for (auto pair{0}; pair < stageLength; ++pair) {
+            auto const tw = w(pair * twStride);
+
+            auto const i1 = k + pair;
+            auto const i2 = k + pair + stageLength;
+
+            for (auto ch{0U}; ch < x.extent(0); ++ch) {
+                auto const temp = tw * x(ch, i2);
+                x(ch, i2)       = x(ch, i1) - temp;
+                x(ch, i1)       = x(ch, i1) + temp;
+            }
+        }
+    }
+}
+
+}  // namespace detail
+
+/// \brief Transforms all rows of a (channel, index) matrix in one pass.
+///
+/// \details Same algorithm as StaticComplexPlanV2, but the bit-reversal table
+/// and every twiddle factor are loaded once and applied to all channels. The
+/// number of channels is taken from the matrix, use a static extent (e.g.
+/// StereoBlock like layouts) to let the compiler unroll the channel loop.
+///
+/// \ingroup grit-fft
+template<typename Complex, etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 2)
+struct StaticBatchedComplexPlan
+{
+    using ValueType = Complex;
+    using SizeType  = etl::size_t;
+
+    StaticBatchedComplexPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    template<etl::linalg::inout_matrix InOutMat>
+        requires etl::same_as<typename InOutMat::value_type, Complex>
+    auto operator()(InOutMat x, Direction dir) -> void
+    {
+        auto runStages = [x]<etl::size_t... Stage>(etl::index_sequence<Stage...>, etl::linalg::in_vector auto w) {
+            (detail::staticBatchedDit2Stage<Stage>(x, w), ...);
+        };
+
+        _reorder(x);
+
+        auto const w = etl::mdspan<Complex const, etl::extents<etl::size_t, size() / 2>>{twiddles.data()};
+
+        if (dir == Direction::Forward) {
+            runStages(etl::make_index_sequence<order()>(), w);
+        } else {
+            runStages(etl::make_index_sequence<order()>(), etl::linalg::conjugated(w));
+        }
+    }
+
+private:
+    static constexpr auto twiddles = detail::makeTwiddles<typename Complex::value_type, Size>();
+
+    StaticBitrevorderPlan<Size> _reorder{};
+};
+
+}  // namespace grit::fft
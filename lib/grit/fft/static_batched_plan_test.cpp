@@ -0,0 +1,56 @@
+#include "static_batched_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+template<typename Float, etl::size_t Size, etl::size_t Channels>
+auto testStaticBatchedComplexPlan(grit::fft::Direction dir) -> void
+{
+    using Complex = etl::complex<Float>;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto buf = etl::array<Complex, Size * Channels>{};
+    etl::generate(buf.begin(), buf.end(), [&] { return Complex{dist(rng), dist(rng)}; });
+    auto ref = buf;
+
+    // channel major, same layout as StereoBlock
+    auto x    = etl::mdspan<Complex, etl::extents<etl::size_t, Channels, Size>, etl::layout_left>{buf.data()};
+    auto plan = grit::fft::StaticBatchedComplexPlan<Complex, Size>{};
+    plan(x, dir);
+
+    auto refPlan = grit::fft::StaticComplexPlanV2<Complex, Size>{};
+    auto channel = etl::array<Complex, Size>{};
+    for (auto ch{0U}; ch < Channels; ++ch) {
+        for (auto i{0U}; i < Size; ++i) {
+            channel[i] = ref[i * Channels + ch];
+        }
+
+        refPlan(etl::mdspan{channel.data(), etl::extents<etl::size_t, Size>{}}, dir);
+
+        for (auto i{0U}; i < Size; ++i) {
+            REQUIRE_THAT(x(ch, i).real(), Catch::Matchers::WithinAbs(channel[i].real(), tolerance));
+            REQUIRE_THAT(x(ch, i).imag(), Catch::Matchers::WithinAbs(channel[i].imag(), tolerance));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StaticBatchedComplexPlan", "", float, double)
+{
+    using grit::fft::Direction;
+
+    for (auto dir : {Direction::Forward, Direction::Backward}) {
+        testStaticBatchedComplexPlan<TestType, 2, 1>(dir);
+        testStaticBatchedComplexPlan<TestType, 16, 2>(dir);
+        testStaticBatchedComplexPlan<TestType, 64, 2>(dir);
+        testStaticBatchedComplexPlan<TestType, 256, 4>(dir);
+        testStaticBatchedComplexPlan<TestType, 1024, 2>(dir);
+        testStaticBatchedComplexPlan<TestType, 128, 3>(dir);
+    }
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+
+#include <etl/array.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/type_traits.hpp>
+#include <etl/utility.hpp>
+
+namespace grit::fft {
+
+namespace detail {
+
+struct MixedRadixFactors
+{
+    etl::array<etl::size_t, 32> radices{};
+    etl::size_t count{0};
+};
+
+/// Splits n into radix 5, 3 & 2 factors. The count is zero, if n has any other prime factor.
+[[nodiscard]] constexpr auto factorizeMixedRadix(etl::size_t n) -> MixedRadixFactors
+{
+    auto factors = MixedRadixFactors{};
+    for (auto const radix : etl::array<etl::size_t, 3>{5, 3, 2}) {
+        while (n > 1 and n % radix == 0) {
+            factors.radices[factors.count++] = radix;
+            n /= radix;
+        }
+    }
+
+    if (n != 1) {
+        factors.count = 0;
+    }
+    return factors;
+}
+
+/// Mixed-radix digit reversal as a gather table: y[i] = x[table[i]]
+template<etl::size_t Size>
+[[nodiscard]] constexpr auto makeDigitReversalTable() -> etl::array<etl::smallest_size_t<Size>, Size>
+{
+    using Index = etl::smallest_size_t<Size>;
+
+    auto const factors = factorizeMixedRadix(Size);
+    auto table         = etl::array<Index, Size>{};
+    for (auto n{0U}; n < Size; ++n) {
+        auto remaining = n;
+        auto block     = Size;
+        auto pos       = etl::size_t(0);
+        for (auto l{0U}; l < factors.count; ++l) {
+            block /= factors.radices[l];
+            pos += (remaining % factors.radices[l]) * block;
+            remaining /= factors.radices[l];
+        }
+        table[pos] = static_cast<Index>(n);
+    }
+    return table;
+}
+
+template<typename Float, etl::size_t Size>
+[[nodiscard]] constexpr auto makeMixedRadixTwiddles() -> etl::array<etl::complex<Float>, Size>
+{
+    auto table = etl::array<etl::complex<Float>, Size>{};
+    for (auto i{0U}; i < Size; ++i) {
+        table[i] = twiddle<Float>(i, Size, Direction::Forward);
+    }
+    return table;
+}
+
+/// sign * j * z
+template<typename Complex>
+[[nodiscard]] constexpr auto rotate(Complex z, typename Complex::value_type sign) -> Complex
+{
+    return Complex{-sign * z.imag(), sign * z.real()};
+}
+
+/// In-place DFT of size Radix. sign is -1 for the forward and +1 for the backward direction.
+template<etl::size_t Radix, typename Complex>
+auto mixedRadixButterfly(etl::array<Complex, Radix>& a, typename Complex::value_type sign) -> void
+{
+    using Float = typename Complex::value_type;
+
+    if constexpr (Radix == 2) {
+        auto const a0 = a[0];
+        a[0]          = a0 + a[1];
+        a[1]          = a0 - a[1];
+    } else if constexpr (Radix == 3) {
+        static constexpr auto s = Float(0.86602540378443864676);  // sin(2pi/3)
+
+        auto const t = a[1] + a[2];
+        auto const d = rotate((a[1] - a[2]) * s, sign);
+        auto const m = a[0] - t * Float(0.5);
+
+        a[0] = a[0] + t;
+        a[1] = m + d;
+        a[2] = m - d;
+    } else {
+        static_assert(Radix == 5);
+        static constexpr auto c1 = Float(0.30901699437494742410);   // cos(2pi/5)
+        static constexpr auto c2 = Float(-0.80901699437494742410);  // cos(4pi/5)
+        static constexpr auto s1 = Float(0.95105651629515357212);   // sin(2pi/5)
+        static constexpr auto s2 = Float(0.58778525229247312917);   // sin(4pi/5)
+
+        auto const t1 = a[1] + a[4];
+        auto const t2 = a[2] + a[3];
+        auto const d1 = a[1] - a[4];
+        auto const d2 = a[2] - a[3];
+
+        auto const m1 = a[0] + t1 * c1 + t2 * c2;
+        auto const m2 = a[0] + t1 * c2 + t2 * c1;
+        auto const n1 = rotate(d1 * s1 + d2 * s2, sign);
+        auto const n2 = rotate(d1 * s2 - d2 * s1, sign);
+
+        a[0] = a[0] + t1 + t2;
+        a[1] = m1 + n1;
+        a[4] = m1 - n1;
+        a[2] = m2 + n2;
+        a[3] = m2 - n2;
+    }
+}
+
+/// Combines Radix neighbouring transforms of size Length into one of size Radix * Length
+template<etl::size_t Radix, etl::size_t Length, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+auto staticMixedRadixStage(InOutVec x, InVec w, typename InOutVec::value_type::value_type sign) -> void
+{
+    using Complex = typename InOutVec::value_type;
+
+    static constexpr auto const span     = Radix * Length;
+    static constexpr auto const twStride = InVec::static_extent(0) / span;
+
+    auto a = etl::array<Complex, Radix>{};
+
+    for (auto b{0U}; b < x.extent(0); b += span) {
+        // k == 0, all twiddles are one
+        for (auto q{0U}; q < Radix; ++q) {
+            a[q] = x(b + q * Length);
+        }
+        mixedRadixButterfly(a, sign);
+        for (auto q{0U}; q < Radix; ++q) {
+            x(b + q * Length) = a[q];
+        }
+
+        for (auto k{1U}; k < Length; ++k) {
+            a[0] = x(b + k);
+            for (auto q{1U}; q < Radix; ++q) {
+                a[q] = x(b + q * Length + k) * w(q * k * twStride);
+            }
+            mixedRadixButterfly(a, sign);
+            for (auto q{0U}; q < Radix; ++q) {
+                x(b + q * Length + k) = a[q];
+            }
+        }
+    }
+}
+
+}  // namespace detail
+
+/// \brief Mixed-radix transform for sizes of the form 2^a * 3^b * 5^c.
+///
+/// \details Useful for block sizes like 48, 96 or 192 which are common at
+/// 48kHz. The input is gathered through a precomputed digit-reversal table into
+/// an internal buffer, then every radix 2, 3 or 5 stage is run in place. The
+/// stage radices & lengths are compile time constants.
+///
+/// \ingroup grit-fft
+template<typename Complex, etl::size_t Size>
+    requires(Size >= 2 and detail::factorizeMixedRadix(Size).count > 0)
+struct StaticMixedRadixPlan
+{
+    using ValueType = Complex;
+    using SizeType  = etl::size_t;
+
+    StaticMixedRadixPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    /// Number of radix stages
+    [[nodiscard]] static constexpr auto numStages() -> etl::size_t { return factors.count; }
+
+    template<etl::linalg::inout_vector InOutVec>
+        requires etl::same_as<typename InOutVec::value_type, Complex>
+    auto operator()(InOutVec x, Direction dir) -> void
+    {
+        using Float = typename Complex::value_type;
+
+        auto const y = etl::mdspan<Complex, etl::extents<etl::size_t, Size>>{_scratch.data()};
+
+        auto runStages = [y]<etl::size_t... Stage>(etl::index_sequence<Stage...>, auto w, Float sign) {
+            (detail::staticMixedRadixStage<radix(Stage), length(Stage)>(y, w, sign), ...);
+        };
+
+        for (auto i{0U}; i < Size; ++i) {
+            y(i) = x(permutation[i]);
+        }
+
+        auto const w = etl::mdspan<Complex const, etl::extents<etl::size_t, Size>>{twiddles.data()};
+
+        if (dir == Direction::Forward) {
+            runStages(etl::make_index_sequence<numStages()>(), w, Float(-1));
+        } else {
+            runStages(etl::make_index_sequence<numStages()>(), etl::linalg::conjugated(w), Float(1));
+        }
+
+        for (auto i{0U}; i < Size; ++i) {
+            x(i) = y(i);
+        }
+    }
+
+private:
+    static constexpr auto factors     = detail::factorizeMixedRadix(Size);
+    static constexpr auto permutation = detail::makeDigitReversalTable<Size>();
+    static constexpr auto twiddles    = detail::makeMixedRadixTwiddles<typename Complex::value_type, Size>();
+
+    /// Stages run from the last factor (shortest transforms) to the first
+    [[nodiscard]] static constexpr auto radix(etl::size_t stage) -> etl::size_t
+    {
+        return factors.radices[factors.count - 1 - stage];
+    }
+
+    [[nodiscard]] static constexpr auto length(etl::size_t stage) -> etl::size_t
+    {
+        auto len = etl::size_t(1);
+        for (auto s{0U}; s < stage; ++s) {
+            len *= radix(s);
+        }
+        return len;
+    }
+
+    etl::array<Complex, Size> _scratch{};
+};
+
+}  // namespace grit::fft
@@ -0,0 +1,88 @@
+#include "static_mixed_radix_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+template<typename Float, etl::size_t Size>
+auto testStaticMixedRadixPlan(grit::fft::Direction dir) -> void
+{
+    using Complex = etl::complex<Float>;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto buf = etl::array<Complex, Size>{};
+    etl::generate(buf.begin(), buf.end(), [&] { return Complex{dist(rng), dist(rng)}; });
+
+    // naive dft as reference
+    auto ref = etl::array<etl::complex<double>, Size>{};
+    for (auto k{0U}; k < Size; ++k) {
+        for (auto n{0U}; n < Size; ++n) {
+            auto const w = grit::fft::detail::twiddle<double>(k * n, Size, dir);
+            ref[k] += etl::complex<double>{buf[n].real(), buf[n].imag()} * w;
+        }
+    }
+
+    auto plan = grit::fft::StaticMixedRadixPlan<Complex, Size>{};
+    plan(etl::mdspan{buf.data(), etl::extents<etl::size_t, Size>{}}, dir);
+
+    for (auto i{0U}; i < Size; ++i) {
+        REQUIRE_THAT(buf[i].real(), Catch::Matchers::WithinAbs(ref[i].real(), tolerance));
+        REQUIRE_THAT(buf[i].imag(), Catch::Matchers::WithinAbs(ref[i].imag(), tolerance));
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StaticMixedRadixPlan", "", float, double)
+{
+    using grit::fft::Direction;
+
+    for (auto dir : {Direction::Forward, Direction::Backward}) {
+        testStaticMixedRadixPlan<TestType, 2>(dir);
+        testStaticMixedRadixPlan<TestType, 3>(dir);
+        testStaticMixedRadixPlan<TestType, 5>(dir);
+        testStaticMixedRadixPlan<TestType, 6>(dir);
+        testStaticMixedRadixPlan<TestType, 15>(dir);
+        testStaticMixedRadixPlan<TestType, 30>(dir);
+        testStaticMixedRadixPlan<TestType, 48>(dir);
+        testStaticMixedRadixPlan<TestType, 64>(dir);
+        testStaticMixedRadixPlan<TestType, 96>(dir);
+        testStaticMixedRadixPlan<TestType, 125>(dir);
+        testStaticMixedRadixPlan<TestType, 192>(dir);
+        testStaticMixedRadixPlan<TestType, 360>(dir);
+    }
+}
+
+TEST_CASE("fft: factorizeMixedRadix")
+{
+    using grit::fft::detail::factorizeMixedRadix;
+
+    STATIC_REQUIRE(factorizeMixedRadix(1).count == 0);
+    STATIC_REQUIRE(factorizeMixedRadix(7).count == 0);
+    STATIC_REQUIRE(factorizeMixedRadix(42).count == 0);
+    STATIC_REQUIRE(factorizeMixedRadix(2).count == 1);
+    STATIC_REQUIRE(factorizeMixedRadix(48).count == 5);
+    STATIC_REQUIRE(factorizeMixedRadix(96).count == 6);
+    STATIC_REQUIRE(factorizeMixedRadix(360).count == 6);
+
+    static constexpr auto factors = factorizeMixedRadix(60);
+    STATIC_REQUIRE(factors.radices[0] == 5);
+    STATIC_REQUIRE(factors.radices[1] == 3);
+    STATIC_REQUIRE(factors.radices[2] == 2);
+    STATIC_REQUIRE(factors.radices[3] == 2);
+}
+
+TEST_CASE("fft: makeDigitReversalTable")
+{
+    // power of two sizes match the bit-reversal permutation
+    static constexpr auto bitrev = grit::fft::detail::makeDigitReversalTable<8>();
+    STATIC_REQUIRE(bitrev == etl::array<etl::uint8_t, 8>{0, 4, 2, 6, 1, 5, 3, 7});
+
+    // 6 = 3 * 2, first split by 3
+    static constexpr auto mixed = grit::fft::detail::makeDigitReversalTable<6>();
+    STATIC_REQUIRE(mixed == etl::array<etl::uint8_t, 6>{0, 3, 1, 4, 2, 5});
+}
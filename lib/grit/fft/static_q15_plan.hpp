@@ -0,0 +1,208 @@
+#pragma once
+
+#include <grit/core/arm.hpp>
+#include <grit/fft/bitrevorder.hpp>
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+#include <grit/math/ilog2.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstdint.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit::fft {
+
+/// \brief Packs a complex value in [-1, 1) into one 32-bit word. Real part in the low, imaginary in the high half.
+/// \ingroup grit-fft
+template<etl::floating_point Float>
+[[nodiscard]] constexpr auto packQ15(etl::complex<Float> z) -> etl::uint32_t
+{
+    auto const toQ15 = [](Float v) {
+        auto const scaled = static_cast<etl::int32_t>(v * Float(32768) + (v < Float(0) ? Float(-0.5) : Float(0.5)));
+        return static_cast<etl::int16_t>(etl::clamp(scaled, TA_Q15_MIN, TA_Q15_MAX));
+    };
+    return arm::pkhbt(toQ15(z.real()), toQ15(z.imag()), 16);
+}
+
+/// \brief Unpacks a Q15 pair and applies the block exponent returned by StaticQ15ComplexPlan.
+/// \ingroup grit-fft
+template<etl::floating_point Float>
+[[nodiscard]] constexpr auto unpackQ15(etl::uint32_t z, int exponent = 0) -> etl::complex<Float>
+{
+    auto const scale = static_cast<Float>(etl::uint32_t(1) << static_cast<unsigned>(exponent)) / Float(32768);
+    auto const re    = static_cast<Float>(arm::detail::lo16(z));
+    auto const im    = static_cast<Float>(arm::detail::hi16(z));
+    return {re * scale, im * scale};
+}
+
+namespace detail {
+
+template<unsigned Size>
+[[nodiscard]] constexpr auto makeQ15Twiddles() -> etl::array<etl::uint32_t, Size / 2>
+{
+    auto table = etl::array<etl::uint32_t, Size / 2>{};
+    for (auto i{0U}; i < Size / 2; ++i) {
+        table[i] = packQ15(twiddle<double>(i, Size, Direction::Forward));
+    }
+    return table;
+}
+
+/// Largest absolute value of all real & imaginary parts
+template<etl::linalg::in_vector Vec>
+[[nodiscard]] auto q15Peak(Vec x) -> etl::int32_t
+{
+    auto peak = etl::int32_t{0};
+    for (auto i{0U}; i < x.extent(0); ++i) {
+        auto const re = arm::detail::lo16(x(i));
+        auto const im = arm::detail::hi16(x(i));
+        peak          = etl::max(peak, etl::max(re < 0 ? -re : re, im < 0 ? -im : im));
+    }
+    return peak;
+}
+
+/// Radix-2 DIT stage on packed Q15 complex words. Halving stages scale the output by 1/2.
+template<bool Halve, Direction Dir, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+auto q15Dit2Stage(InOutVec x, InVec w, etl::size_t stage) -> void
+{
+    static constexpr auto const shift = Halve ? 16 : 15;
+    static constexpr auto const round = etl::int32_t(1) << (shift - 1);
+
+    auto const size        = x.extent(0);
+    auto const stageLength = etl::size_t(1) << stage;
+    auto const stride      = stageLength * 2;
+    auto const twStride    = size / stride;
+
+    for (auto k{0U}; k < size; k += stride) {
+        for (auto pair{0U}; pair < stageLength; ++pair) {
+            auto const tw = w(pair * twStride);
+
+            auto const i1 = k + pair;
+            auto const i2 = k + pair + stageLength;
+
+            auto const a = x(i1);
+            auto const b = x(i2);
+
+            // Q15 * Q15 -> Q30, both products are summed by a single dual MAC.
+            // Rounding instead of truncating keeps the error from growing as a dc bias
+            auto re = etl::int32_t{};
+            auto im = etl::int32_t{};
+            if constexpr (Dir == Direction::Forward) {
+                re = static_cast<etl::int32_t>(arm::smusd(b, tw));
+                im = static_cast<etl::int32_t>(arm::smuadx(b, tw));
+            } else {
+                re = static_cast<etl::int32_t>(arm::smuad(b, tw));
+                im = static_cast<etl::int32_t>(arm::smusdx(tw, b));
+            }
+
+            auto const t = arm::pkhbt(
+                static_cast<etl::int16_t>((re + round) >> shift),
+                static_cast<etl::int16_t>((im + round) >> shift),
+                16
+            );
+
+            if constexpr (Halve) {
+                auto const ah = arm::shadd16(a, 0);
+                x(i1)         = arm::qadd16(ah, t);
+                x(i2)         = arm::qsub16(ah, t);
+            } else {
+                x(i1) = arm::qadd16(a, t);
+                x(i2) = arm::qsub16(a, t);
+            }
+        }
+    }
+}
+
+}  // namespace detail
+
+/// \brief Packed Q15 complex transform with block floating point scaling.
+///
+/// \details Each complex sample is stored in one 32-bit word, real part in the
+/// low half-word, see packQ15() & unpackQ15(). Butterflies use the packed
+/// dual 16-bit instructions from grit/core/arm.hpp, the twiddle products are
+/// accumulated at Q31 precision.
+///
+/// A radix-2 butterfly can grow each component by up to (1 + sqrt(2)). Before
+/// every stage the peak magnitude is measured, stages that might overflow
+/// scale their output by 1/2. The number of halvings is returned as the block
+/// exponent, the true spectrum is x * 2^exponent. The backward transform is
+/// unscaled apart from the block exponent, matching StaticComplexPlan.
+///
+/// \ingroup grit-fft
+template<etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 2)
+struct StaticQ15ComplexPlan
+{
+    using ValueType = etl::uint32_t;
+    using SizeType  = etl::size_t;
+
+    StaticQ15ComplexPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    /// Returns the block exponent of the result
+    template<etl::linalg::inout_vector Vec>
+        requires(etl::same_as<typename Vec::value_type, etl::uint32_t>)
+    auto operator()(Vec x, Direction dir) -> int;
+
+private:
+    /// Butterfly outputs stay below full scale without halving
+    static constexpr auto halveLimit = etl::int32_t{0x2000};
+
+    /// Halving butterfly outputs stay below full scale
+    static constexpr auto prescaleLimit = etl::int32_t{0x6A00};
+
+    static constexpr auto twiddles = detail::makeQ15Twiddles<Size>();
+
+    StaticBitrevorderPlan<Size> _reorder{};
+};
+
+template<etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 2)
+template<etl::linalg::inout_vector Vec>
+    requires(etl::same_as<typename Vec::value_type, etl::uint32_t>)
+auto StaticQ15ComplexPlan<Size>::operator()(Vec x, Direction dir) -> int
+{
+    auto const w = etl::mdspan<etl::uint32_t const, etl::extents<etl::size_t, Size / 2>>{twiddles.data()};
+
+    _reorder(x);
+
+    auto exponent = 0;
+    for (auto stage{0U}; stage < order(); ++stage) {
+        auto peak = detail::q15Peak(x);
+
+        // Only possible for (nearly) full scale input
+        if (peak > prescaleLimit) {
+            for (auto i{0U}; i < Size; ++i) {
+                x(i) = arm::shadd16(x(i), 0);
+            }
+            peak /= 2;
+            ++exponent;
+        }
+
+        if (peak >= halveLimit) {
+            ++exponent;
+            if (dir == Direction::Forward) {
+                detail::q15Dit2Stage<true, Direction::Forward>(x, w, stage);
+            } else {
+                detail::q15Dit2Stage<true, Direction::Backward>(x, w, stage);
+            }
+        } else {
+            if (dir == Direction::Forward) {
+                detail::q15Dit2Stage<false, Direction::Forward>(x, w, stage);
+            } else {
+                detail::q15Dit2Stage<false, Direction::Backward>(x, w, stage);
+            }
+        }
+    }
+
+    return exponent;
+}
+
+}  // namespace grit::fft
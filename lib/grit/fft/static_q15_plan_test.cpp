@@ -0,0 +1,99 @@
+#include "static_q15_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+template<etl::size_t Size>
+auto testStaticQ15ComplexPlan(double amplitude, grit::fft::Direction dir) -> void
+{
+    using Complex = etl::complex<double>;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<double>{-amplitude, amplitude};
+
+    auto refBuf = etl::array<Complex, Size>{};
+    auto q15Buf = etl::array<etl::uint32_t, Size>{};
+    for (auto i{0U}; i < Size; ++i) {
+        q15Buf[i] = grit::fft::packQ15(Complex{dist(rng), dist(rng)});
+        refBuf[i] = grit::fft::unpackQ15<double>(q15Buf[i]);
+    }
+
+    auto ref     = etl::mdspan{refBuf.data(), etl::extents<etl::size_t, Size>{}};
+    auto refPlan = grit::fft::StaticComplexPlanV2<Complex, Size>{};
+    refPlan(ref, dir);
+
+    auto q15          = etl::mdspan{q15Buf.data(), etl::extents<etl::size_t, Size>{}};
+    auto plan         = grit::fft::StaticQ15ComplexPlan<Size>{};
+    auto const scaleE = plan(q15, dir);
+    REQUIRE(scaleE >= 0);
+    REQUIRE(scaleE <= static_cast<int>(plan.order()) + 1);
+
+    // Error relative to the largest bin plus one LSB of truncation per stage
+    auto peak = 0.0;
+    for (auto const& bin : refBuf) {
+        peak = etl::max(peak, etl::max(etl::abs(bin.real()), etl::abs(bin.imag())));
+    }
+    auto const lsb       = grit::fft::unpackQ15<double>(1U, scaleE).real();
+    auto const tolerance = peak * 2e-3 + lsb * static_cast<double>(plan.order());
+
+    for (auto i{0U}; i < Size; ++i) {
+        auto const bin = grit::fft::unpackQ15<double>(q15Buf[i], scaleE);
+        REQUIRE_THAT(bin.real(), Catch::Matchers::WithinAbs(refBuf[i].real(), tolerance));
+        REQUIRE_THAT(bin.imag(), Catch::Matchers::WithinAbs(refBuf[i].imag(), tolerance));
+    }
+}
+
+TEST_CASE("fft: StaticQ15ComplexPlan")
+{
+    using grit::fft::Direction;
+
+    for (auto dir : {Direction::Forward, Direction::Backward}) {
+        for (auto amplitude : {0.01, 0.25, 0.999}) {
+            testStaticQ15ComplexPlan<2>(amplitude, dir);
+            testStaticQ15ComplexPlan<8>(amplitude, dir);
+            testStaticQ15ComplexPlan<64>(amplitude, dir);
+            testStaticQ15ComplexPlan<256>(amplitude, dir);
+            testStaticQ15ComplexPlan<1024>(amplitude, dir);
+        }
+    }
+}
+
+TEST_CASE("fft: StaticQ15ComplexPlan impulse")
+{
+    auto buf  = etl::array<etl::uint32_t, 64>{};
+    auto x    = etl::mdspan{buf.data(), etl::extents<etl::size_t, 64>{}};
+    auto plan = grit::fft::StaticQ15ComplexPlan<64>{};
+
+    // small signals are transformed without any scaling
+    buf[0] = grit::fft::packQ15(etl::complex<float>{0.125F, 0.0F});
+    REQUIRE(plan(x, grit::fft::Direction::Forward) == 0);
+    for (auto const bin : buf) {
+        REQUIRE(bin == buf[0]);
+    }
+
+    // full-scale dc is halved by every stage, the last one needs no scaling
+    etl::fill(buf.begin(), buf.end(), grit::fft::packQ15(etl::complex<float>{0.5F, -0.5F}));
+    auto const exponent = plan(x, grit::fft::Direction::Forward);
+    auto const dc       = grit::fft::unpackQ15<float>(buf[0], exponent);
+    REQUIRE_THAT(dc.real(), Catch::Matchers::WithinAbs(32.0, 32.0 * 1e-3));
+    REQUIRE_THAT(dc.imag(), Catch::Matchers::WithinAbs(-32.0, 32.0 * 1e-3));
+    for (auto i{1U}; i < buf.size(); ++i) {
+        auto const bin = grit::fft::unpackQ15<float>(buf[i], exponent);
+        REQUIRE_THAT(bin.real(), Catch::Matchers::WithinAbs(0.0, 32.0 * 1e-3));
+    }
+}
+
+TEST_CASE("fft: packQ15/unpackQ15")
+{
+    STATIC_REQUIRE(grit::fft::packQ15(etl::complex<double>{1.0, -1.0}) == 0x8000'7FFFU);
+    STATIC_REQUIRE(grit::fft::packQ15(etl::complex<double>{0.5, 0.0}) == 0x0000'4000U);
+
+    auto const z = grit::fft::unpackQ15<double>(grit::fft::packQ15(etl::complex<double>{0.25, -0.75}));
+    REQUIRE(z.real() == 0.25);
+    REQUIRE(z.imag() == -0.75);
+    REQUIRE(grit::fft::unpackQ15<double>(0x0000'4000U, 3).real() == 4.0);
+}
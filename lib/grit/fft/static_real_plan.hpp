@@ -0,0 +1,122 @@
+#pragma once
+
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+#include <grit/math/ilog2.hpp>
+
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit::fft {
+
+/// \brief Real-to-complex & complex-to-real transform of size N.
+///
+/// \details Packs the N real samples into a N/2 point complex transform (even
+/// samples in the real part, odd samples in the imaginary part) and separates
+/// the two interleaved spectra with a post-twiddle split pass. The forward
+/// transform writes the N/2+1 non-redundant bins, the backward transform reads
+/// them and returns the unscaled (multiplied by N) real signal, matching the
+/// convention of StaticComplexPlan.
+///
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 4)
+struct StaticRealPlan
+{
+    using RealType    = Float;
+    using ComplexType = etl::complex<Float>;
+    using SizeType    = etl::size_t;
+
+    StaticRealPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    /// Number of complex bins produced by the forward transform: N/2+1
+    [[nodiscard]] static constexpr auto numBins() -> etl::size_t { return Size / 2 + 1; }
+
+    /// Forward real-to-complex transform.
+    template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec>
+        requires(
+            etl::same_as<typename InVec::value_type, Float>
+            and etl::same_as<typename OutVec::value_type, ComplexType>
+        )
+    auto operator()(InVec input, OutVec output) -> void
+    {
+        static constexpr auto const half = Size / 2;
+
+        auto z = etl::mdspan<ComplexType, etl::extents<etl::size_t, half>>{_buf.data()};
+        for (auto i{0U}; i < half; ++i) {
+            z(i) = ComplexType{input(2 * i), input(2 * i + 1)};
+        }
+
+        _plan(z, Direction::Forward);
+
+        auto const dc  = z(0).real();
+        auto const nyq = z(0).imag();
+        output(0)      = ComplexType{dc + nyq, Float(0)};
+        output(half)   = ComplexType{dc - nyq, Float(0)};
+
+        for (auto k{1U}; k < half; ++k) {
+            auto const zk  = z(k);
+            auto const zmk = etl::conj(z(half - k));
+            auto const tw  = twiddles[k];
+
+            // E[k] = (Z[k] + Z*[M-k]) / 2, O[k] = (Z[k] - Z*[M-k]) / 2j
+            auto const even = (zk + zmk) * Float(0.5);
+            auto const diff = (zk - zmk) * Float(0.5);
+            auto const odd  = ComplexType{diff.imag(), -diff.real()};
+
+            output(k) = even + tw * odd;
+        }
+    }
+
+    /// Backward complex-to-real transform. The result is scaled by N.
+    template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec>
+        requires(
+            etl::same_as<typename InVec::value_type, ComplexType>
+            and etl::same_as<typename OutVec::value_type, Float>
+        )
+    auto operator()(InVec input, OutVec output) -> void
+    {
+        static constexpr auto const half = Size / 2;
+
+        auto z = etl::mdspan<ComplexType, etl::extents<etl::size_t, half>>{_buf.data()};
+
+        auto const dc  = input(0).real();
+        auto const nyq = input(half).real();
+        z(0)           = ComplexType{dc + nyq, dc - nyq};
+
+        for (auto k{1U}; k < half; ++k) {
+            auto const xk  = input(k);
+            auto const xmk = etl::conj(input(half - k));
+            auto const tw  = etl::conj(twiddles[k]);
+
+            // 2E[k] = X[k] + X*[M-k], 2O[k] = (X[k] - X*[M-k]) * W^-k
+            auto const even = xk + xmk;
+            auto const odd  = (xk - xmk) * tw;
+
+            z(k) = even + ComplexType{-odd.imag(), odd.real()};
+        }
+
+        _plan(z, Direction::Backward);
+
+        for (auto i{0U}; i < half; ++i) {
+            output(2 * i)     = z(i).real();
+            output(2 * i + 1) = z(i).imag();
+        }
+    }
+
+private:
+    static constexpr auto twiddles = detail::makeTwiddles<Float, Size>();
+
+    StaticComplexPlanV2<ComplexType, Size / 2> _plan{};
+    etl::array<ComplexType, Size / 2> _buf{};
+};
+
+}  // namespace grit::fft
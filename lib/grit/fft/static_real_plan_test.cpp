@@ -0,0 +1,81 @@
+#include "static_real_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+template<typename Float, etl::size_t Size>
+auto testStaticRealPlan() -> void
+{
+    using Plan    = grit::fft::StaticRealPlan<Float, Size>;
+    using Complex = typename Plan::ComplexType;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto inBuf  = etl::array<Float, Size>{};
+    auto binBuf = etl::array<Complex, Plan::numBins()>{};
+    auto outBuf = etl::array<Float, Size>{};
+    etl::generate(inBuf.begin(), inBuf.end(), [&] { return dist(rng); });
+
+    auto in   = etl::mdspan{inBuf.data(), etl::extents<etl::size_t, Size>{}};
+    auto bins = etl::mdspan{binBuf.data(), etl::extents<etl::size_t, Plan::numBins()>{}};
+    auto out  = etl::mdspan{outBuf.data(), etl::extents<etl::size_t, Size>{}};
+
+    auto plan = Plan{};
+    plan(in, bins);
+
+    // compare against complex transform of the same signal
+    auto refBuf = etl::array<Complex, Size>{};
+    for (auto i{0U}; i < Size; ++i) {
+        refBuf[i] = Complex{inBuf[i], Float(0)};
+    }
+    auto ref     = etl::mdspan{refBuf.data(), etl::extents<etl::size_t, Size>{}};
+    auto refPlan = grit::fft::StaticComplexPlanV2<Complex, Size>{};
+    refPlan(ref, grit::fft::Direction::Forward);
+
+    for (auto i{0U}; i < Plan::numBins(); ++i) {
+        REQUIRE_THAT(binBuf[i].real(), Catch::Matchers::WithinAbs(refBuf[i].real(), tolerance));
+        REQUIRE_THAT(binBuf[i].imag(), Catch::Matchers::WithinAbs(refBuf[i].imag(), tolerance));
+    }
+
+    // roundtrip
+    plan(bins, out);
+    for (auto i{0U}; i < Size; ++i) {
+        REQUIRE_THAT(outBuf[i] / Float(Size), Catch::Matchers::WithinAbs(inBuf[i], tolerance));
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StaticRealPlan", "", float, double)
+{
+    testStaticRealPlan<TestType, 4>();
+    testStaticRealPlan<TestType, 8>();
+    testStaticRealPlan<TestType, 64>();
+    testStaticRealPlan<TestType, 128>();
+    testStaticRealPlan<TestType, 256>();
+    testStaticRealPlan<TestType, 512>();
+    testStaticRealPlan<TestType, 1024>();
+}
+
+TEMPLATE_TEST_CASE("fft: StaticRealPlan impulse", "", float, double)
+{
+    using Float   = TestType;
+    using Plan    = grit::fft::StaticRealPlan<Float, 64>;
+    using Complex = typename Plan::ComplexType;
+
+    auto inBuf  = etl::array<Float, Plan::size()>{};
+    auto binBuf = etl::array<Complex, Plan::numBins()>{};
+    inBuf[0]    = Float(1);
+
+    auto plan = Plan{};
+    plan(etl::mdspan{inBuf.data(), etl::extents{inBuf.size()}}, etl::mdspan{binBuf.data(), etl::extents{binBuf.size()}});
+
+    for (auto const& bin : binBuf) {
+        REQUIRE_THAT(bin.real(), Catch::Matchers::WithinAbs(1.0, 1e-6));
+        REQUIRE_THAT(bin.imag(), Catch::Matchers::WithinAbs(0.0, 1e-6));
+    }
+}
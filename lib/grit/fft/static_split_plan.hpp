@@ -0,0 +1,132 @@
+#pragma once
+
+#include <grit/fft/bitrevorder.hpp>
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+#include <grit/math/ilog2.hpp>
+
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+#include <etl/utility.hpp>
+
+namespace grit::fft {
+
+/// \brief Copies interleaved complex values into separate real & imaginary vectors.
+/// \ingroup grit-fft
+template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutRe, etl::linalg::out_vector OutIm>
+auto deinterleave(InVec x, OutRe re, OutIm im) -> void
+{
+    for (auto i{0U}; i < x.extent(0); ++i) {
+        re(i) = x(i).real();
+        im(i) = x(i).imag();
+    }
+}
+
+/// \brief Copies separate real & imaginary vectors into interleaved complex values.
+/// \ingroup grit-fft
+template<etl::linalg::in_vector InRe, etl::linalg::in_vector InIm, etl::linalg::out_vector OutVec>
+auto interleave(InRe re, InIm im, OutVec x) -> void
+{
+    using Complex = typename OutVec::value_type;
+    for (auto i{0U}; i < x.extent(0); ++i) {
+        x(i) = Complex{re(i), im(i)};
+    }
+}
+
+namespace detail {
+
+/// Twiddles for all stages, stage s starts at offset 2^s - 1. Index 0 holds the real, 1 the imaginary parts.
+template<etl::floating_point Float, etl::size_t Size>
+[[nodiscard]] constexpr auto makeSplitTwiddles() -> etl::array<etl::array<Float, Size - 1>, 2>
+{
+    auto table = etl::array<etl::array<Float, Size - 1>, 2>{};
+    for (auto stageLength = etl::size_t(1); stageLength < Size; stageLength *= 2) {
+        for (auto j{0U}; j < stageLength; ++j) {
+            auto const w                  = twiddle<Float>(j, stageLength * 2, Direction::Forward);
+            table[0][stageLength - 1 + j] = w.real();
+            table[1][stageLength - 1 + j] = w.imag();
+        }
+    }
+    return table;
+}
+
+template<etl::size_t Stage, etl::linalg::inout_vector InOutVec, etl::linalg::in_vector InVec>
+auto staticSplitDit2Stage(InOutVec re, InOutVec im, InVec wr, InVec wi, typename InOutVec::value_type sign) -> void
+{
+    static constexpr auto const stageLength = etl::size_t(1) << Stage;
+    static constexpr auto const stride      = stageLength * 2;
+
+    auto const size = re.extent(0);
+
+    for (auto k{0U}; k < size; k += stride) {
+        for (auto j{0U}; j < stageLength; ++j) {
+            auto const twr = wr(stageLength - 1 + j);
+            auto const twi = wi(stageLength - 1 + j) * sign;
+
+            auto const i1 = k + j;
+            auto const i2 = k + j + stageLength;
+
+            auto const tr = twr * re(i2) - twi * im(i2);
+            auto const ti = twr * im(i2) + twi * re(i2);
+
+            re(i2) = re(i1) - tr;
+            im(i2) = im(i1) - ti;
+            re(i1) = re(i1) + tr;
+            im(i1) = im(i1) + ti;
+        }
+    }
+}
+
+}  // namespace detail
+
+/// \brief Radix-2 DIT transform on split (structure of arrays) complex data.
+///
+/// \details Real and imaginary parts live in separate vectors, so every
+/// butterfly loop is a plain stream of Float loads & stores which the
+/// compiler can vectorize. The twiddles are stored per stage (N-1 entries per
+/// component instead of N/2) to keep the twiddle loads contiguous as well.
+/// Use deinterleave() & interleave() to convert from/to etl::complex arrays.
+///
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 2)
+struct StaticSplitComplexPlan
+{
+    using ValueType = Float;
+    using SizeType  = etl::size_t;
+
+    StaticSplitComplexPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    template<etl::linalg::inout_vector InOutVec>
+        requires etl::same_as<typename InOutVec::value_type, Float>
+    auto operator()(InOutVec re, InOutVec im, Direction dir) -> void
+    {
+        using Table = etl::mdspan<Float const, etl::extents<etl::size_t, Size - 1>>;
+
+        auto const wr   = Table{twiddles[0].data()};
+        auto const wi   = Table{twiddles[1].data()};
+        auto const sign = dir == Direction::Forward ? Float(1) : Float(-1);
+
+        _reorder(re);
+        _reorder(im);
+
+        [=]<etl::size_t... Stage>(etl::index_sequence<Stage...>) {
+            (detail::staticSplitDit2Stage<Stage>(re, im, wr, wi, sign), ...);
+        }(etl::make_index_sequence<order()>());
+    }
+
+private:
+    static constexpr auto twiddles = detail::makeSplitTwiddles<Float, Size>();
+
+    StaticBitrevorderPlan<Size> _reorder{};
+};
+
+}  // namespace grit::fft
@@ -0,0 +1,88 @@
+#include "static_split_plan.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+template<typename Float, etl::size_t Size>
+auto testStaticSplitComplexPlan(grit::fft::Direction dir) -> void
+{
+    using Complex = etl::complex<Float>;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto refBuf = etl::array<Complex, Size>{};
+    etl::generate(refBuf.begin(), refBuf.end(), [&] { return Complex{dist(rng), dist(rng)}; });
+
+    auto reBuf  = etl::array<Float, Size>{};
+    auto imBuf  = etl::array<Float, Size>{};
+    auto outBuf = etl::array<Complex, Size>{};
+
+    auto ref = etl::mdspan{refBuf.data(), etl::extents<etl::size_t, Size>{}};
+    auto re  = etl::mdspan{reBuf.data(), etl::extents<etl::size_t, Size>{}};
+    auto im  = etl::mdspan{imBuf.data(), etl::extents<etl::size_t, Size>{}};
+    auto out = etl::mdspan{outBuf.data(), etl::extents<etl::size_t, Size>{}};
+
+    grit::fft::deinterleave(ref, re, im);
+
+    auto plan = grit::fft::StaticSplitComplexPlan<Float, Size>{};
+    plan(re, im, dir);
+
+    auto refPlan = grit::fft::StaticComplexPlanV2<Complex, Size>{};
+    refPlan(ref, dir);
+
+    grit::fft::interleave(re, im, out);
+    for (auto i{0U}; i < Size; ++i) {
+        REQUIRE_THAT(outBuf[i].real(), Catch::Matchers::WithinAbs(refBuf[i].real(), tolerance));
+        REQUIRE_THAT(outBuf[i].imag(), Catch::Matchers::WithinAbs(refBuf[i].imag(), tolerance));
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StaticSplitComplexPlan", "", float, double)
+{
+    using grit::fft::Direction;
+
+    for (auto dir : {Direction::Forward, Direction::Backward}) {
+        testStaticSplitComplexPlan<TestType, 2>(dir);
+        testStaticSplitComplexPlan<TestType, 4>(dir);
+        testStaticSplitComplexPlan<TestType, 16>(dir);
+        testStaticSplitComplexPlan<TestType, 64>(dir);
+        testStaticSplitComplexPlan<TestType, 256>(dir);
+        testStaticSplitComplexPlan<TestType, 1024>(dir);
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: deinterleave/interleave", "", float, double)
+{
+    using Float   = TestType;
+    using Complex = etl::complex<Float>;
+
+    auto const in = etl::array<Complex, 3>{
+        Complex{Float(1), Float(2)},
+        Complex{Float(3), Float(4)},
+        Complex{Float(5), Float(6)},
+    };
+    auto re  = etl::array<Float, 3>{};
+    auto im  = etl::array<Float, 3>{};
+    auto out = etl::array<Complex, 3>{};
+
+    grit::fft::deinterleave(
+        etl::mdspan{in.data(), etl::extents{in.size()}},
+        etl::mdspan{re.data(), etl::extents{re.size()}},
+        etl::mdspan{im.data(), etl::extents{im.size()}}
+    );
+    REQUIRE(re == etl::array<Float, 3>{Float(1), Float(3), Float(5)});
+    REQUIRE(im == etl::array<Float, 3>{Float(2), Float(4), Float(6)});
+
+    grit::fft::interleave(
+        etl::mdspan{re.data(), etl::extents{re.size()}},
+        etl::mdspan{im.data(), etl::extents{im.size()}},
+        etl::mdspan{out.data(), etl::extents{out.size()}}
+    );
+    REQUIRE(out == in);
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <grit/fft/direction.hpp>
+#include <grit/fft/fft.hpp>
+#include <grit/math/ilog2.hpp>
+
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit::fft {
+
+/// \brief Transforms two real signals with a single complex transform of size N.
+///
+/// \details The left channel is packed into the real, the right channel into
+/// the imaginary part. The spectra are separated using the symmetry of real
+/// signals: L[k] = (Z[k] + Z*[N-k]) / 2 and R[k] = (Z[k] - Z*[N-k]) / 2j.
+/// Input and output are (channel, index) matrices, so a StereoBlock of N
+/// samples can be passed directly. Each channel has N/2+1 bins. The backward
+/// transform is unscaled (multiplied by N), matching StaticComplexPlan.
+///
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size>
+    requires(etl::has_single_bit(Size) and Size >= 2)
+struct StaticStereoRealPlan
+{
+    using RealType    = Float;
+    using ComplexType = etl::complex<Float>;
+    using SizeType    = etl::size_t;
+
+    StaticStereoRealPlan() = default;
+
+    [[nodiscard]] static constexpr auto size() -> etl::size_t { return Size; }
+
+    [[nodiscard]] static constexpr auto order() -> etl::size_t { return ilog2(Size); }
+
+    /// Number of complex bins per channel: N/2+1
+    [[nodiscard]] static constexpr auto numBins() -> etl::size_t { return Size / 2 + 1; }
+
+    /// Forward transform of both channels.
+    template<etl::linalg::in_matrix InMat, etl::linalg::inout_matrix OutMat>
+        requires(
+            etl::same_as<typename InMat::value_type, Float>
+            and etl::same_as<typename OutMat::value_type, ComplexType>
+        )
+    auto operator()(InMat input, OutMat output) -> void
+    {
+        auto z = etl::mdspan<ComplexType, etl::extents<etl::size_t, Size>>{_buf.data()};
+        for (auto i{0U}; i < Size; ++i) {
+            z(i) = ComplexType{input(0, i), input(1, i)};
+        }
+
+        _plan(z, Direction::Forward);
+
+        for (auto k{0U}; k < numBins(); ++k) {
+            auto const zk  = z(k);
+            auto const zmk = etl::conj(z((Size - k) % Size));
+
+            auto const sum  = (zk + zmk) * Float(0.5);
+            auto const diff = (zk - zmk) * Float(0.5);
+
+            output(0, k) = sum;
+            output(1, k) = ComplexType{diff.imag(), -diff.real()};
+        }
+    }
+
+    /// Backward transform of both channels. The result is scaled by N.
+    template<etl::linalg::in_matrix InMat, etl::linalg::inout_matrix OutMat>
+        requires(
+            etl::same_as<typename InMat::value_type, ComplexType>
+            and etl::same_as<typename OutMat::value_type, Float>
+        )
+    auto operator()(InMat input, OutMat output) -> void
+    {
+        auto z = etl::mdspan<ComplexType, etl::extents<etl::size_t, Size>>{_buf.data()};
+
+        // Z[k] = L[k] + j R[k], upper half from the conjugate symmetry of L & R
+        for (auto k{0U}; k < numBins(); ++k) {
+            auto const l = input(0, k);
+            auto const r = input(1, k);
+            z(k)         = l + ComplexType{-r.imag(), r.real()};
+        }
+        for (auto k = numBins(); k < Size; ++k) {
+            auto const l = etl::conj(input(0, Size - k));
+            auto const r = etl::conj(input(1, Size - k));
+            z(k)         = l + ComplexType{-r.imag(), r.real()};
+        }
+
+        _plan(z, Direction::Backward);
+
+        for (auto i{0U}; i < Size; ++i) {
+            output(0, i) = z(i).real();
+            output(1, i) = z(i).imag();
+        }
+    }
+
+private:
+    StaticComplexPlanV2<ComplexType, Size> _plan{};
+    etl::array<ComplexType, Size> _buf{};
+};
+
+}  // namespace grit::fft
@@ -0,0 +1,71 @@
+#include "static_stereo_real_plan.hpp"
+
+#include <grit/fft/static_real_plan.hpp>
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+template<typename Float, etl::size_t Size>
+auto testStaticStereoRealPlan() -> void
+{
+    using Plan    = grit::fft::StaticStereoRealPlan<Float, Size>;
+    using Complex = typename Plan::ComplexType;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-3 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto inBuf  = etl::array<Float, Size * 2>{};
+    auto binBuf = etl::array<Complex, Plan::numBins() * 2>{};
+    auto outBuf = etl::array<Float, Size * 2>{};
+    etl::generate(inBuf.begin(), inBuf.end(), [&] { return dist(rng); });
+
+    // Same layout as StereoBlock
+    using Layout = etl::layout_left;
+    auto in      = etl::mdspan<Float, etl::extents<etl::size_t, 2, Size>, Layout>{inBuf.data()};
+    auto bins    = etl::mdspan<Complex, etl::extents<etl::size_t, 2, Plan::numBins()>, Layout>{binBuf.data()};
+    auto out     = etl::mdspan<Float, etl::extents<etl::size_t, 2, Size>, Layout>{outBuf.data()};
+
+    auto plan = Plan{};
+    plan(in, bins);
+
+    if constexpr (Size >= 4) {
+        auto refPlan = grit::fft::StaticRealPlan<Float, Size>{};
+        auto channel = etl::array<Float, Size>{};
+        auto refBins = etl::array<Complex, Plan::numBins()>{};
+
+        for (auto ch{0U}; ch < 2; ++ch) {
+            for (auto i{0U}; i < Size; ++i) {
+                channel[i] = in(ch, i);
+            }
+
+            refPlan(
+                etl::mdspan{channel.data(), etl::extents<etl::size_t, Size>{}},
+                etl::mdspan{refBins.data(), etl::extents<etl::size_t, Plan::numBins()>{}}
+            );
+
+            for (auto k{0U}; k < Plan::numBins(); ++k) {
+                REQUIRE_THAT(bins(ch, k).real(), Catch::Matchers::WithinAbs(refBins[k].real(), tolerance));
+                REQUIRE_THAT(bins(ch, k).imag(), Catch::Matchers::WithinAbs(refBins[k].imag(), tolerance));
+            }
+        }
+    }
+
+    plan(bins, out);
+    for (auto i{0U}; i < inBuf.size(); ++i) {
+        REQUIRE_THAT(outBuf[i] / Float(Size), Catch::Matchers::WithinAbs(inBuf[i], tolerance));
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StaticStereoRealPlan", "", float, double)
+{
+    testStaticStereoRealPlan<TestType, 2>();
+    testStaticStereoRealPlan<TestType, 4>();
+    testStaticStereoRealPlan<TestType, 64>();
+    testStaticStereoRealPlan<TestType, 256>();
+    testStaticStereoRealPlan<TestType, 1024>();
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <grit/fft/static_real_plan.hpp>
+#include <grit/fft/window.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/complex.hpp>
+#include <etl/concepts.hpp>
+#include <etl/linalg.hpp>
+#include <etl/mdspan.hpp>
+
+namespace grit::fft {
+
+/// \brief Streaming short-time fourier transform analysis & resynthesis.
+///
+/// \details Accepts any number of samples per call. Input and output are
+/// buffered internally and every HopSize samples a new frame is windowed,
+/// transformed, handed to the spectral callback, transformed back and
+/// overlap-added. To avoid bursting all of that work into a single audio
+/// callback, the three steps are scheduled at 0, 1/3 and 2/3 of the hop. This
+/// costs one extra hop of latency, see latency().
+///
+/// The window pair must satisfy the constant overlap-add constraint for the
+/// hop size, the resulting gain is compensated for in the synthesis window.
+///
+/// \ingroup grit-fft
+template<
+    etl::floating_point Float,
+    etl::size_t FrameSize,
+    etl::size_t HopSize,
+    Window AnalysisWindow  = Window::SqrtHann,
+    Window SynthesisWindow = Window::SqrtHann>
+struct StftProcessor
+{
+    static_assert(HopSize > 0 and HopSize <= FrameSize);
+    static_assert(
+        isConstantOverlapAdd<Float, FrameSize>(AnalysisWindow, SynthesisWindow, HopSize),
+        "window pair does not satisfy COLA for this hop size"
+    );
+
+    using SampleType  = Float;
+    using ComplexType = etl::complex<Float>;
+    using Spectrum    = etl::mdspan<ComplexType, etl::extents<etl::size_t, FrameSize / 2 + 1>>;
+
+    StftProcessor() = default;
+
+    [[nodiscard]] static constexpr auto frameSize() -> etl::size_t { return FrameSize; }
+
+    [[nodiscard]] static constexpr auto hopSize() -> etl::size_t { return HopSize; }
+
+    [[nodiscard]] static constexpr auto numBins() -> etl::size_t { return FrameSize / 2 + 1; }
+
+    /// Delay in samples between input and output
+    [[nodiscard]] static constexpr auto latency() -> etl::size_t { return FrameSize + HopSize; }
+
+    auto reset() -> void;
+
+    /// Calls callback(Spectrum) once per hop. Input and output may alias.
+    template<etl::linalg::in_vector InVec, etl::linalg::out_vector OutVec, etl::invocable<Spectrum> Callback>
+    auto operator()(InVec input, OutVec output, Callback&& callback) -> void
+    {
+        for (auto i{0U}; i < input.extent(0); ++i) {
+            _input[_inputPos] = input(i);
+            _inputPos         = _inputPos + 1 == FrameSize ? 0 : _inputPos + 1;
+
+            output(i) = _overlapAdd[_hopPos];
+
+            if (++_hopPos == HopSize) {
+                startFrame();
+            }
+
+            runScheduledStep(callback);
+        }
+    }
+
+private:
+    enum struct Step : int
+    {
+        Idle,
+        Forward,
+        Callback,
+        Backward,
+    };
+
+    using Frame = etl::mdspan<Float, etl::extents<etl::size_t, FrameSize>>;
+
+    static constexpr auto analysis  = makeWindow<Float, FrameSize>(AnalysisWindow);
+    static constexpr auto synthesis = [] {
+        auto const gain = overlapAddGain<Float, FrameSize>(AnalysisWindow, SynthesisWindow, HopSize);
+        auto window     = makeWindow<Float, FrameSize>(SynthesisWindow);
+        for (auto& w : window) {
+            w /= gain * Float(FrameSize);
+        }
+        return window;
+    }();
+
+    auto startFrame() -> void;
+
+    template<typename Callback>
+    auto runScheduledStep(Callback& callback) -> void;
+
+    StaticRealPlan<Float, FrameSize> _fft{};
+
+    Step _step{Step::Idle};
+    etl::size_t _hopPos{0};
+    etl::size_t _inputPos{0};
+
+    etl::array<Float, FrameSize> _input{};
+    etl::array<Float, FrameSize> _frame{};
+    etl::array<ComplexType, FrameSize / 2 + 1> _spectrum{};
+    etl::array<Float, FrameSize + HopSize> _overlapAdd{};
+};
+
+template<etl::floating_point Float, etl::size_t FrameSize, etl::size_t HopSize, Window AW, Window SW>
+auto StftProcessor<Float, FrameSize, HopSize, AW, SW>::reset() -> void
+{
+    _step     = Step::Idle;
+    _hopPos   = 0;
+    _inputPos = 0;
+    etl::fill(_input.begin(), _input.end(), Float(0));
+    etl::fill(_overlapAdd.begin(), _overlapAdd.end(), Float(0));
+}
+
+template<etl::floating_point Float, etl::size_t FrameSize, etl::size_t HopSize, Window AW, Window SW>
+auto StftProcessor<Float, FrameSize, HopSize, AW, SW>::startFrame() -> void
+{
+    _hopPos = 0;
+    _step   = Step::Forward;
+
+    // Samples [0, HopSize) have been played back, previous frames move into place
+    etl::copy(_overlapAdd.begin() + HopSize, _overlapAdd.end(), _overlapAdd.begin());
+    etl::fill(_overlapAdd.begin() + FrameSize, _overlapAdd.end(), Float(0));
+
+    // Oldest sample is at the write position of the ring buffer
+    for (auto i{0U}; i < FrameSize; ++i) {
+        auto const pos = _inputPos + i;
+        _frame[i]      = _input[pos < FrameSize ? pos : pos - FrameSize] * analysis[i];
+    }
+}
+
+template<etl::floating_point Float, etl::size_t FrameSize, etl::size_t HopSize, Window AW, Window SW>
+template<typename Callback>
+auto StftProcessor<Float, FrameSize, HopSize, AW, SW>::runScheduledStep(Callback& callback) -> void
+{
+    auto const frame    = Frame{_frame.data()};
+    auto const spectrum = Spectrum{_spectrum.data()};
+
+    if (_step == Step::Forward) {
+        _fft(frame, spectrum);
+        _step = Step::Callback;
+    }
+
+    if (_step == Step::Callback and _hopPos >= HopSize / 3) {
+        callback(spectrum);
+        _step = Step::Backward;
+    }
+
+    if (_step == Step::Backward and _hopPos >= HopSize * 2 / 3) {
+        _fft(spectrum, frame);
+        for (auto i{0U}; i < FrameSize; ++i) {
+            _overlapAdd[HopSize + i] += _frame[i] * synthesis[i];
+        }
+        _step = Step::Idle;
+    }
+}
+
+}  // namespace grit::fft
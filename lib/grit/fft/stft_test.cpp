@@ -0,0 +1,114 @@
+#include "stft.hpp"
+
+#include <etl/random.hpp>
+
+#include <catch2/catch_get_random_seed.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+template<typename Stft>
+auto testStftIdentity(etl::size_t blockSize) -> void
+{
+    using Float = typename Stft::SampleType;
+
+    static constexpr auto numSamples = Stft::latency() + Stft::frameSize() * 4;
+
+    auto const tolerance = sizeof(Float) == 4 ? 1e-4 : 1e-9;
+
+    auto rng  = etl::xoshiro128plusplus{Catch::getSeed()};
+    auto dist = etl::uniform_real_distribution<Float>{Float(-1), Float(+1)};
+
+    auto input = etl::array<Float, numSamples>{};
+    etl::generate(input.begin(), input.end(), [&] { return dist(rng); });
+
+    auto output = input;
+    auto frames = etl::size_t(0);
+    auto stft   = Stft{};
+
+    for (auto i = etl::size_t(0); i < numSamples; i += blockSize) {
+        auto const count = etl::min(blockSize, numSamples - i);
+        auto const block = etl::mdspan{output.data() + i, etl::extents{count}};
+        stft(block, block, [&](auto) { ++frames; });
+    }
+
+    REQUIRE(frames == (numSamples - Stft::hopSize() / 3) / Stft::hopSize());
+
+    for (auto i{0U}; i < Stft::latency(); ++i) {
+        REQUIRE_THAT(output[i], Catch::Matchers::WithinAbs(0.0, tolerance));
+    }
+    for (auto i = Stft::latency(); i < numSamples; ++i) {
+        REQUIRE_THAT(output[i], Catch::Matchers::WithinAbs(input[i - Stft::latency()], tolerance));
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StftProcessor", "", float, double)
+{
+    using Float = TestType;
+    using grit::fft::StftProcessor;
+    using grit::fft::Window;
+
+    STATIC_REQUIRE(StftProcessor<Float, 64, 16>::numBins() == 33);
+    STATIC_REQUIRE(StftProcessor<Float, 64, 16>::latency() == 80);
+
+    for (auto blockSize : {1U, 3U, 7U, 16U, 32U, 100U}) {
+        testStftIdentity<StftProcessor<Float, 32, 16>>(blockSize);
+        testStftIdentity<StftProcessor<Float, 64, 16>>(blockSize);
+        testStftIdentity<StftProcessor<Float, 64, 32, Window::Hann, Window::Rectangular>>(blockSize);
+        testStftIdentity<StftProcessor<Float, 128, 32, Window::Hann, Window::Hann>>(blockSize);
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StftProcessor spreads work across callbacks", "", float, double)
+{
+    using Float = TestType;
+    using Stft  = grit::fft::StftProcessor<Float, 64, 32>;
+
+    auto buffer = etl::array<Float, 1>{};
+    auto block  = etl::mdspan{buffer.data(), etl::extents{buffer.size()}};
+
+    // The spectral callback runs a third of a hop after the frame was captured
+    auto calls = etl::array<etl::size_t, Stft::hopSize() * 4>{};
+    auto stft  = Stft{};
+    for (auto i{0U}; i < calls.size(); ++i) {
+        stft(block, block, [&](auto) { ++calls[i]; });
+    }
+
+    for (auto i{0U}; i < calls.size(); ++i) {
+        auto const afterFirstFrame = i >= Stft::hopSize();
+        auto const expected        = afterFirstFrame and (i + 1) % Stft::hopSize() == Stft::hopSize() / 3 ? 1U : 0U;
+        REQUIRE(calls[i] == expected);
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: StftProcessor spectral modification", "", float, double)
+{
+    using Float = TestType;
+    using Stft  = grit::fft::StftProcessor<Float, 64, 16>;
+
+    auto buffer = etl::array<Float, 512>{};
+    etl::fill(buffer.begin(), buffer.end(), Float(1));
+
+    auto stft  = Stft{};
+    auto block = etl::mdspan{buffer.data(), etl::extents{buffer.size()}};
+    stft(block, block, [](Stft::Spectrum spectrum) {
+        for (auto i{0U}; i < spectrum.extent(0); ++i) {
+            spectrum(i) *= Float(0.5);
+        }
+    });
+
+    for (auto i = Stft::latency(); i < buffer.size(); ++i) {
+        REQUIRE_THAT(buffer[i], Catch::Matchers::WithinAbs(0.5, 1e-5));
+    }
+
+    stft.reset();
+    etl::fill(buffer.begin(), buffer.end(), Float(1));
+    stft(block, block, [](Stft::Spectrum spectrum) {
+        for (auto i{0U}; i < spectrum.extent(0); ++i) {
+            spectrum(i) = {};
+        }
+    });
+
+    for (auto const sample : buffer) {
+        REQUIRE_THAT(sample, Catch::Matchers::WithinAbs(0.0, 1e-6));
+    }
+}
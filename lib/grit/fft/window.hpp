@@ -0,0 +1,86 @@
+#pragma once
+
+#include <grit/fft/fft.hpp>
+
+#include <etl/array.hpp>
+#include <etl/concepts.hpp>
+#include <etl/cstddef.hpp>
+
+namespace grit::fft {
+
+/// \ingroup grit-fft
+enum struct Window : int
+{
+    Rectangular,
+    Hann,
+    SqrtHann,
+    BlackmanHarris,
+};
+
+/// \brief Creates a periodic window of length Size.
+/// \details Usable in constant expressions, so the tables can live in read-only memory.
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size>
+[[nodiscard]] constexpr auto makeWindow(Window window) -> etl::array<Float, Size>
+{
+    auto table = etl::array<Float, Size>{};
+    for (auto i{0U}; i < Size; ++i) {
+        if (window == Window::Hann) {
+            // 0.5 - 0.5 * cos(2 pi i / N)
+            table[i] = Float(0.5) - Float(0.5) * detail::twiddle<Float>(i, Size, Direction::Backward).real();
+        } else if (window == Window::SqrtHann) {
+            // sin(pi i / N)
+            table[i] = detail::twiddle<Float>(i, Size * 2, Direction::Backward).imag();
+        } else if (window == Window::BlackmanHarris) {
+            // 4-term, -92dB side lobes. For spectral measurements, not overlap-add.
+            auto const c1 = detail::twiddle<Float>(i, Size, Direction::Backward).real();
+            auto const c2 = detail::twiddle<Float>(i * 2, Size, Direction::Backward).real();
+            auto const c3 = detail::twiddle<Float>(i * 3, Size, Direction::Backward).real();
+            table[i]      = Float(0.35875) - Float(0.48829) * c1 + Float(0.14128) * c2 - Float(0.01168) * c3;
+        } else {
+            table[i] = Float(1);
+        }
+    }
+    return table;
+}
+
+/// \brief Returns the sum of the overlapped analysis * synthesis window products.
+/// \details Returns zero if the sum is not constant (within 1e-6) over all
+/// positions, i.e. the window pair does not satisfy the constant overlap-add
+/// (COLA) constraint for the given hop size.
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size>
+[[nodiscard]] constexpr auto overlapAddGain(Window analysis, Window synthesis, etl::size_t hop) -> Float
+{
+    if (hop == 0 or hop > Size) {
+        return Float(0);
+    }
+
+    auto const a = makeWindow<double, Size>(analysis);
+    auto const s = makeWindow<double, Size>(synthesis);
+
+    auto gain = 0.0;
+    for (auto n{0U}; n < hop; ++n) {
+        auto sum = 0.0;
+        for (auto i = n; i < Size; i += hop) {
+            sum += a[i] * s[i];
+        }
+
+        if (n == 0) {
+            gain = sum;
+        } else if (auto const diff = sum - gain; diff > 1e-6 or diff < -1e-6) {
+            return Float(0);
+        }
+    }
+
+    return static_cast<Float>(gain);
+}
+
+/// \ingroup grit-fft
+template<etl::floating_point Float, etl::size_t Size>
+[[nodiscard]] constexpr auto isConstantOverlapAdd(Window analysis, Window synthesis, etl::size_t hop) -> bool
+{
+    return overlapAddGain<Float, Size>(analysis, synthesis, hop) > Float(0);
+}
+
+}  // namespace grit::fft
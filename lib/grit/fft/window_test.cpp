@@ -0,0 +1,59 @@
+#include "window.hpp"
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEMPLATE_TEST_CASE("fft: makeWindow", "", float, double)
+{
+    using Float = TestType;
+    using grit::fft::Window;
+
+    static constexpr auto hann = grit::fft::makeWindow<Float, 64>(Window::Hann);
+    STATIC_REQUIRE(hann[0] == Float(0));
+    REQUIRE_THAT(hann[16], Catch::Matchers::WithinAbs(0.5, 1e-6));
+    REQUIRE_THAT(hann[32], Catch::Matchers::WithinAbs(1.0, 1e-6));
+    REQUIRE_THAT(hann[48], Catch::Matchers::WithinAbs(0.5, 1e-6));
+
+    auto const sqrtHann = grit::fft::makeWindow<Float, 64>(Window::SqrtHann);
+    for (auto i{0U}; i < hann.size(); ++i) {
+        REQUIRE_THAT(sqrtHann[i] * sqrtHann[i], Catch::Matchers::WithinAbs(hann[i], 1e-6));
+    }
+
+    auto const blackmanHarris = grit::fft::makeWindow<Float, 64>(Window::BlackmanHarris);
+    REQUIRE_THAT(blackmanHarris[0], Catch::Matchers::WithinAbs(0.00006, 1e-6));
+    REQUIRE_THAT(blackmanHarris[32], Catch::Matchers::WithinAbs(1.0, 1e-6));
+    for (auto i{1U}; i < blackmanHarris.size(); ++i) {
+        REQUIRE_THAT(blackmanHarris[i], Catch::Matchers::WithinAbs(blackmanHarris[64 - i], 1e-6));
+    }
+
+    auto const rect = grit::fft::makeWindow<Float, 64>(Window::Rectangular);
+    for (auto const w : rect) {
+        REQUIRE(w == Float(1));
+    }
+}
+
+TEMPLATE_TEST_CASE("fft: isConstantOverlapAdd", "", float, double)
+{
+    using Float = TestType;
+    using grit::fft::Window;
+
+    STATIC_REQUIRE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Hann, Window::Rectangular, 32));
+    STATIC_REQUIRE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Hann, Window::Rectangular, 16));
+    STATIC_REQUIRE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::SqrtHann, Window::SqrtHann, 32));
+    STATIC_REQUIRE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Hann, Window::Hann, 16));
+    STATIC_REQUIRE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Rectangular, Window::Rectangular, 64));
+
+    STATIC_REQUIRE_FALSE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Hann, Window::Hann, 32));
+    STATIC_REQUIRE_FALSE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Hann, Window::Rectangular, 64));
+    STATIC_REQUIRE_FALSE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Hann, Window::Rectangular, 24));
+    STATIC_REQUIRE_FALSE(grit::fft::isConstantOverlapAdd<Float, 64>(Window::Hann, Window::Rectangular, 0));
+
+    REQUIRE_THAT(
+        (grit::fft::overlapAddGain<Float, 64>(Window::Hann, Window::Rectangular, 16)),
+        Catch::Matchers::WithinAbs(2.0, 1e-6)
+    );
+    REQUIRE_THAT(
+        (grit::fft::overlapAddGain<Float, 64>(Window::Hann, Window::Hann, 16)),
+        Catch::Matchers::WithinAbs(1.5, 1e-6)
+    );
+}
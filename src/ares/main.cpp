@@ -1,3 +1,5 @@
+#include <grit/core/footprint.hpp>
+#include <grit/core/load_meter.hpp>
 #include <grit/eurorack/ares.hpp>
 
 #include <etl/linalg.hpp>
@@ -9,17 +11,25 @@ namespace ares {
 static constexpr auto blockSize  = 32U;
 static constexpr auto sampleRate = 96'000.0F;
 
+// 16.9 KiB on x86-64, see grit-footprint
+GRIT_RAM_BUDGET(grit::Ares, 20 * 1024);
+
 auto processor = grit::Ares{};
 auto patch     = daisy::patch_sm::DaisyPatchSM{};
 auto button    = daisy::Switch{};
 auto toggle    = daisy::Switch{};
 
+// Audio callback load, readable from the main loop or a debugger
+auto loadMeter = grit::LoadMeter<grit::CycleCounterClock>{};
+
 auto audioCallback(
     daisy::AudioHandle::InterleavingInputBuffer in,
     daisy::AudioHandle::InterleavingOutputBuffer out,
     size_t size
 ) -> void
 {
+    auto const measurement = grit::ScopedLoadMeasurement{loadMeter};
+
     patch.ProcessAllControls();
     button.Debounce();
     toggle.Debounce();
@@ -54,6 +64,9 @@ auto main() -> int
 
     ares::processor.prepare(ares::sampleRate, ares::blockSize);
 
+    grit::CycleCounterClock::enable();
+    ares::loadMeter.prepare(ares::sampleRate, ares::blockSize, float(daisy::System::GetSysClkFreq()));
+
     ares::patch.SetAudioSampleRate(ares::sampleRate);
     ares::patch.SetAudioBlockSize(ares::blockSize);
     ares::patch.StartAudio(ares::audioCallback);
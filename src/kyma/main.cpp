@@ -1,3 +1,5 @@
+#include <grit/core/footprint.hpp>
+#include <grit/core/load_meter.hpp>
 #include <grit/eurorack/kyma.hpp>
 
 #include <etl/linalg.hpp>
@@ -9,17 +11,25 @@ namespace kyma {
 static constexpr auto blockSize  = 16U;
 static constexpr auto sampleRate = 96'000.0F;
 
+// 352 bytes on x86-64, see grit-footprint
+GRIT_RAM_BUDGET(grit::Kyma, 512);
+
 auto patch     = daisy::patch_sm::DaisyPatchSM{};
 auto toggle    = daisy::Switch{};
 auto button    = daisy::Switch{};
 auto processor = grit::Kyma{};
 
+// Audio callback load, readable from the main loop or a debugger
+auto loadMeter = grit::LoadMeter<grit::CycleCounterClock>{};
+
 auto audioCallback(
     daisy::AudioHandle::InterleavingInputBuffer in,
     daisy::AudioHandle::InterleavingOutputBuffer out,
     size_t size
 ) -> void
 {
+    auto const measurement = grit::ScopedLoadMeasurement{loadMeter};
+
     patch.ProcessAllControls();
     toggle.Debounce();
     button.Debounce();
@@ -57,6 +67,9 @@ auto main() -> int
 
     kyma::processor.prepare(kyma::sampleRate, kyma::blockSize);
 
+    grit::CycleCounterClock::enable();
+    kyma::loadMeter.prepare(kyma::sampleRate, kyma::blockSize, float(daisy::System::GetSysClkFreq()));
+
     kyma::patch.SetAudioSampleRate(kyma::sampleRate);
     kyma::patch.SetAudioBlockSize(kyma::blockSize);
     kyma::patch.StartAudio(kyma::audioCallback);
@@ -1,3 +1,6 @@
+#include <grit/core/footprint.hpp>
+#include <grit/core/load_meter.hpp>
+#include <grit/core/profile.hpp>
 #include <grit/eurorack/poseidon.hpp>
 
 #include <etl/linalg.hpp>
@@ -9,17 +12,25 @@ namespace poseidon {
 static constexpr auto blockSize  = 32U;
 static constexpr auto sampleRate = 96'000.0F;
 
+// 26.9 KiB on x86-64, see grit-footprint
+GRIT_RAM_BUDGET(grit::Poseidon, 31 * 1024);
+
 auto processor = grit::Poseidon{};
 auto patch     = daisy::patch_sm::DaisyPatchSM{};
 auto button    = daisy::Switch{};
 auto toggle    = daisy::Switch{};
 
+// Audio callback load, readable from the main loop or a debugger
+auto loadMeter = grit::LoadMeter<grit::CycleCounterClock>{};
+
 auto audioCallback(
     daisy::AudioHandle::InterleavingInputBuffer in,
     daisy::AudioHandle::InterleavingOutputBuffer out,
     size_t size
 ) -> void
 {
+    auto const measurement = grit::ScopedLoadMeasurement{loadMeter};
+
     patch.ProcessAllControls();
     button.Debounce();
     toggle.Debounce();
@@ -67,9 +78,31 @@ auto main() -> int
 
     poseidon::processor.prepare(poseidon::sampleRate, poseidon::blockSize);
 
+    grit::CycleCounterClock::enable();
+    poseidon::loadMeter.prepare(poseidon::sampleRate, poseidon::blockSize, float(daisy::System::GetSysClkFreq()));
+
     poseidon::patch.SetAudioSampleRate(poseidon::sampleRate);
     poseidon::patch.SetAudioBlockSize(poseidon::blockSize);
     poseidon::patch.StartAudio(poseidon::audioCallback);
 
+#if GRIT_ENABLE_PROFILING
+    daisy::patch_sm::DaisyPatchSM::StartLog(false);
+    while (true) {
+        daisy::System::Delay(1000);
+
+        // Counters are written from the audio interrupt, a single line may be slightly off.
+        grit::profile::forEachZone([](grit::profile::ZoneCounter const& zone) {
+            auto const calls = zone.calls;
+            auto const ticks = zone.ticks;
+            daisy::patch_sm::DaisyPatchSM::PrintLine(
+                "%s: %lu calls - %lu cycles/call",
+                zone.name,
+                static_cast<unsigned long>(calls),
+                static_cast<unsigned long>(calls == 0 ? 0 : ticks / calls)
+            );
+        });
+    }
+#else
     while (true) {}
+#endif
 }
@@ -0,0 +1,352 @@
+#pragma once
+
+#include <grit/audio.hpp>
+#include <grit/core/benchmark.hpp>
+#include <grit/fft.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/bit.hpp>
+#include <etl/functional.hpp>
+#include <etl/linalg.hpp>
+#include <etl/numeric.hpp>
+#include <etl/random.hpp>
+
+template<typename RealOrComplex, unsigned N>
+[[nodiscard]] auto makeNoise(auto& rng) -> etl::array<RealOrComplex, N>
+{
+    if constexpr (etl::floating_point<RealOrComplex>) {
+        using Float = RealOrComplex;
+        auto buf    = etl::array<Float, N>{};
+        auto dist   = etl::uniform_real_distribution<Float>{Float(-1.0), Float(1.0)};
+        auto gen    = [&rng, &dist] { return dist(rng); };
+        etl::generate(buf.begin(), buf.end(), gen);
+        return buf;
+    } else {
+        using Float = RealOrComplex::value_type;
+        auto buf    = etl::array<RealOrComplex, N>{};
+        auto dist   = etl::uniform_real_distribution<Float>{Float(-1.0), Float(1.0)};
+        auto gen    = [&rng, &dist] { return RealOrComplex{dist(rng), dist(rng)}; };
+        etl::generate(buf.begin(), buf.end(), gen);
+        return buf;
+    }
+};
+
+struct c2c_dit2_v3
+{
+    c2c_dit2_v3() = default;
+
+    template<etl::linalg::inout_vector Vec>
+    auto operator()(Vec x, auto const& twiddles) const noexcept -> void
+    {
+        auto const size  = x.size();
+        auto const order = grit::ilog2(size);
+
+        {
+            // stage 0
+            static constexpr auto const stage_length = 1;  // grit::ipow<2>(0)
+            static constexpr auto const stride       = 2;  // grit::ipow<2>(0 + 1)
+
+            for (auto k{0}; k < static_cast<int>(size); k += stride) {
+                auto const i1 = k;
+                auto const i2 = k + stage_length;
+
+                auto const temp = x(i1) + x(i2);
+                x(i2)           = x(i1) - x(i2);
+                x(i1)           = temp;
+            }
+        }
+
+        for (auto stage{1ULL}; stage < order; ++stage) {
+
+            auto const stage_length = grit::ipow<2ULL>(stage);
+            auto const stride       = grit::ipow<2ULL>(stage + 1);
+            auto const tw_stride    = grit::ipow<2ULL>(order - stage - 1ULL);
+
+            for (auto k{0ULL}; k < size; k += stride) {
+                for (auto pair{0ULL}; pair < stage_length; ++pair) {
+                    auto const tw = twiddles(pair * tw_stride);
+
+                    auto const i1 = k + pair;
+                    auto const i2 = k + pair + stage_length;
+
+                    auto const temp = x(i1) + tw * x(i2);
+                    x(i2)           = x(i1) - tw * x(i2);
+                    x(i1)           = temp;
+                }
+            }
+        }
+    }
+};
+
+template<typename Float, int N, typename Kernel>
+struct ComplexRoundtrip
+{
+    ComplexRoundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto x      = etl::mdspan<etl::complex<Float>, etl::extents<etl::size_t, N>>{_buf.data()};
+        auto w      = etl::mdspan<etl::complex<Float> const, etl::extents<etl::size_t, N / 2>>{_tw.data()};
+        auto kernel = Kernel{};
+
+        kernel(x, w);
+        kernel(x, etl::linalg::conjugated(w));
+        etl::linalg::scale(Float(1) / Float(N), x);
+
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    etl::array<etl::complex<Float>, N / 2> _tw{grit::fft::detail::makeTwiddles<Float, N>()};
+    etl::array<etl::complex<Float>, N> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<etl::complex<Float>, N>(rng);
+    }()};
+};
+
+template<typename Float, int N, template<typename, etl::size_t> typename Plan = grit::fft::StaticComplexPlanV2>
+struct StaticComplexRoundtrip
+{
+    StaticComplexRoundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto x = etl::mdspan{_buf.data(), etl::extents<etl::size_t, N>{}};
+        _plan(x, grit::fft::Direction::Forward);
+        _plan(x, grit::fft::Direction::Backward);
+        etl::linalg::scale(Float(1) / Float(N), x);
+
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    Plan<etl::complex<Float>, N> _plan{};
+    etl::array<etl::complex<Float>, N> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<etl::complex<Float>, N>(rng);
+    }()};
+};
+
+template<typename Float, int N>
+using StaticStockhamRoundtrip = StaticComplexRoundtrip<Float, N, grit::fft::StaticStockhamPlan>;
+
+template<typename Float, int N>
+using StaticRadix4Roundtrip = StaticComplexRoundtrip<Float, N, grit::fft::StaticRadix4Plan>;
+
+template<typename Float, int N>
+using StaticMixedRadixRoundtrip = StaticComplexRoundtrip<Float, N, grit::fft::StaticMixedRadixPlan>;
+
+template<typename Float, int N>
+struct StaticRealRoundtrip
+{
+    StaticRealRoundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto x    = etl::mdspan{_buf.data(), etl::extents<etl::size_t, N>{}};
+        auto bins = etl::mdspan{_bins.data(), etl::extents<etl::size_t, N / 2 + 1>{}};
+        _plan(x, bins);
+        _plan(bins, x);
+        etl::linalg::scale(Float(1) / Float(N), x);
+
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    grit::fft::StaticRealPlan<Float, N> _plan{};
+    etl::array<etl::complex<Float>, N / 2 + 1> _bins{};
+    etl::array<Float, N> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<Float, N>(rng);
+    }()};
+};
+
+template<typename Float, int N>
+struct StaticSplitRoundtrip
+{
+    StaticSplitRoundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto re = etl::mdspan{_re.data(), etl::extents<etl::size_t, N>{}};
+        auto im = etl::mdspan{_im.data(), etl::extents<etl::size_t, N>{}};
+        _plan(re, im, grit::fft::Direction::Forward);
+        _plan(re, im, grit::fft::Direction::Backward);
+        etl::linalg::scale(Float(1) / Float(N), re);
+        etl::linalg::scale(Float(1) / Float(N), im);
+
+        grit::doNotOptimize(_re.front());
+        grit::doNotOptimize(_im.back());
+    }
+
+private:
+    grit::fft::StaticSplitComplexPlan<Float, N> _plan{};
+    etl::array<Float, N> _re{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<Float, N>(rng);
+    }()};
+    etl::array<Float, N> _im{[] {
+        auto rng = etl::xoshiro128plusplus{43};
+        return makeNoise<Float, N>(rng);
+    }()};
+};
+
+template<int N>
+struct StaticQ15Roundtrip
+{
+    StaticQ15Roundtrip() = default;
+
+    static constexpr auto size() { return N; }
+
+    auto operator()() -> void
+    {
+        auto x = etl::mdspan{_buf.data(), etl::extents<etl::size_t, N>{}};
+        auto forward  = _plan(x, grit::fft::Direction::Forward);
+        auto backward = _plan(x, grit::fft::Direction::Backward);
+
+        grit::doNotOptimize(forward);
+        grit::doNotOptimize(backward);
+
+        grit::doNotOptimize(_buf.front());
+        grit::doNotOptimize(_buf.back());
+    }
+
+private:
+    grit::fft::StaticQ15ComplexPlan<N> _plan{};
+    etl::array<etl::uint32_t, N> _buf{[] {
+        auto rng   = etl::xoshiro128plusplus{42};
+        auto noise = makeNoise<etl::complex<float>, N>(rng);
+        auto buf   = etl::array<etl::uint32_t, N>{};
+        etl::transform(noise.begin(), noise.end(), buf.begin(), [](auto z) { return grit::fft::packQ15(z); });
+        return buf;
+    }()};
+};
+
+/// Stereo, one StaticComplexPlanV2 transform per channel for every hop. The
+/// size is the hop, so the cost per point is per new sample like for the
+/// sliding entries.
+template<int N, int Hop>
+struct StaticComplexHop
+{
+    StaticComplexHop() = default;
+
+    static constexpr auto size() { return Hop; }
+
+    auto operator()() -> void
+    {
+        for (auto i{0U}; i < N; ++i) {
+            _left[i]  = etl::complex<float>{_frame[i * 2 + 0], 0.0F};
+            _right[i] = etl::complex<float>{_frame[i * 2 + 1], 0.0F};
+        }
+
+        _plan(etl::mdspan{_left.data(), etl::extents<etl::size_t, N>{}}, grit::fft::Direction::Forward);
+        _plan(etl::mdspan{_right.data(), etl::extents<etl::size_t, N>{}}, grit::fft::Direction::Forward);
+
+        grit::doNotOptimize(_left[1]);
+        grit::doNotOptimize(_right[1]);
+    }
+
+private:
+    grit::fft::StaticComplexPlanV2<etl::complex<float>, N> _plan{};
+    etl::array<etl::complex<float>, N> _left{};
+    etl::array<etl::complex<float>, N> _right{};
+    etl::array<float, N * 2> _frame{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<float, N * 2>(rng);
+    }()};
+};
+
+/// Stereo, NumBins sliding DFT bins updated for every sample of a hop
+template<int N, int NumBins, int Hop>
+struct SlidingDftHop
+{
+    SlidingDftHop()
+    {
+        auto bins = etl::array<etl::size_t, NumBins>{};
+        etl::iota(bins.begin(), bins.end(), etl::size_t(1));
+        _sdft.setParameter({.bins = bins});
+    }
+
+    static constexpr auto size() { return Hop; }
+
+    auto operator()() -> void
+    {
+        _sdft(etl::mdspan<float, etl::extents<etl::size_t, 2, Hop>, etl::layout_left>{_buf.data()});
+
+        auto bin = _sdft.bin(0, 0);
+        grit::doNotOptimize(bin);
+    }
+
+private:
+    grit::fft::SlidingDft<float, N, NumBins> _sdft{};
+    etl::array<float, Hop * 2> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<float, Hop * 2>(rng);
+    }()};
+};
+
+/// Stereo, NumBins Goertzel filters of a Size N block updated for every sample
+/// of a hop. The bins are evaluated once every N samples.
+template<int N, int NumBins, int Hop>
+struct GoertzelBankHop
+{
+    GoertzelBankHop()
+    {
+        auto bins = etl::array<float, NumBins>{};
+        etl::iota(bins.begin(), bins.end(), 1.0F);
+        _bank.setParameter({.bins = bins});
+    }
+
+    static constexpr auto size() { return Hop; }
+
+    auto operator()() -> void
+    {
+        _bank(etl::mdspan<float, etl::extents<etl::size_t, 2, Hop>, etl::layout_left>{_buf.data()});
+
+        auto bin = _bank.bin(0, 0);
+        grit::doNotOptimize(bin);
+    }
+
+private:
+    grit::fft::GoertzelBank<float, N, NumBins> _bank{};
+    etl::array<float, Hop * 2> _buf{[] {
+        auto rng = etl::xoshiro128plusplus{42};
+        return makeNoise<float, Hop * 2>(rng);
+    }()};
+};
+
+template<typename Processor>
+struct StereoProcessor
+{
+    explicit StereoProcessor(float sampleRate)
+    {
+        if constexpr (requires { _left.setSampleRate(sampleRate); }) {
+            _left.setSampleRate(sampleRate);
+            _right.setSampleRate(sampleRate);
+        }
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            block(0, i) = _left(block(0, i));
+            block(1, i) = _right(block(1, i));
+        }
+    }
+
+private:
+    Processor _left;
+    Processor _right;
+};
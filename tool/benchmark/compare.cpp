@@ -0,0 +1,227 @@
+// Compares a benchmark run against a stored baseline. Both files are in the
+// CSV format written by `grit-benchmark-host --format=csv` or the daisy
+// benchmark. Exits with 1 if any benchmark got slower than the tolerance
+// allows, 2 on usage or parse errors.
+//
+// Usage: grit-benchmark-compare <baseline.csv> <current.csv>
+//            [--tolerance=0.05] [--metric=min|median|p99|max] [--noise-floor=1.0]
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+enum ExitCode : int
+{
+    Success    = EXIT_SUCCESS,
+    Regression = 1,
+    Error      = 2,
+};
+
+struct Options
+{
+    std::string baseline;
+    std::string current;
+    std::string metric{"median"};
+    double tolerance{0.05};
+    double noiseFloor{1.0};
+};
+
+/// Splits a CSV line. Fields may be quoted, quotes inside fields are not supported.
+auto splitCsv(std::string_view line) -> std::vector<std::string>
+{
+    auto fields  = std::vector<std::string>{};
+    auto field   = std::string{};
+    auto inQuote = false;
+
+    for (auto const c : line) {
+        if (c == '"') {
+            inQuote = not inQuote;
+        } else if (c == ',' and not inQuote) {
+            fields.push_back(field);
+            field.clear();
+        } else if (c != '\r') {
+            field.push_back(c);
+        }
+    }
+
+    fields.push_back(field);
+    return fields;
+}
+
+/// Benchmark key (kind, name, size, sample rate) to the selected metric in nanoseconds.
+auto readResults(std::string const& path, std::string const& metric) -> std::optional<std::map<std::string, double>>
+{
+    auto file = std::ifstream{path};
+    if (not file) {
+        std::fprintf(stderr, "error: cannot open '%s'\n", path.c_str());
+        return std::nullopt;
+    }
+
+    auto line = std::string{};
+    if (not std::getline(file, line)) {
+        std::fprintf(stderr, "error: '%s' is empty\n", path.c_str());
+        return std::nullopt;
+    }
+
+    auto const header   = splitCsv(line);
+    auto const columnOf = [&header](std::string const& name) -> std::optional<std::size_t> {
+        for (auto i = std::size_t{0}; i < header.size(); ++i) {
+            if (header[i] == name) {
+                return i;
+            }
+        }
+        return std::nullopt;
+    };
+
+    auto const kind       = columnOf("kind");
+    auto const name       = columnOf("name");
+    auto const size       = columnOf("size");
+    auto const sampleRate = columnOf("sample_rate");
+    auto const value      = columnOf(metric + "_ns");
+    if (not kind or not name or not size or not sampleRate or not value) {
+        std::fprintf(stderr, "error: '%s' has no valid header for metric '%s'\n", path.c_str(), metric.c_str());
+        return std::nullopt;
+    }
+
+    auto results    = std::map<std::string, double>{};
+    auto lineNumber = 1;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty()) {
+            continue;
+        }
+
+        auto const fields = splitCsv(line);
+        if (fields.size() != header.size()) {
+            std::fprintf(stderr, "error: %s:%d: expected %zu fields\n", path.c_str(), lineNumber, header.size());
+            return std::nullopt;
+        }
+
+        auto const* begin = fields[*value].c_str();
+        auto* end         = static_cast<char*>(nullptr);
+        auto const parsed = std::strtod(begin, &end);
+        if (end == begin or *end != '\0') {
+            std::fprintf(stderr, "error: %s:%d: '%s' is not a number\n", path.c_str(), lineNumber, begin);
+            return std::nullopt;
+        }
+
+        auto key = fields[*kind] + " " + fields[*name];
+        key += " size=" + fields[*size] + " rate=" + fields[*sampleRate];
+        results[key] = parsed;
+    }
+
+    return results;
+}
+
+auto parseOptions(int argc, char const* const* argv) -> std::optional<Options>
+{
+    auto options    = Options{};
+    auto positional = std::vector<std::string>{};
+
+    for (auto i{1}; i < argc; ++i) {
+        auto const arg   = std::string_view{argv[i]};
+        auto const value = [arg](std::string_view option) -> std::optional<std::string> {
+            if (arg.starts_with(option)) {
+                return std::string{arg.substr(option.size())};
+            }
+            return std::nullopt;
+        };
+
+        if (auto tolerance = value("--tolerance=")) {
+            options.tolerance = std::strtod(tolerance->c_str(), nullptr);
+        } else if (auto metric = value("--metric=")) {
+            options.metric = *metric;
+        } else if (auto floor = value("--noise-floor=")) {
+            options.noiseFloor = std::strtod(floor->c_str(), nullptr);
+        } else if (arg.starts_with("--")) {
+            std::fprintf(stderr, "error: unknown option '%s'\n", argv[i]);
+            return std::nullopt;
+        } else {
+            positional.emplace_back(arg);
+        }
+    }
+
+    auto const validMetric = options.metric == "min" or options.metric == "median" or options.metric == "p99"
+                          or options.metric == "max";
+    if (positional.size() != 2 or not validMetric or options.tolerance < 0.0) {
+        std::fprintf(
+            stderr,
+            "usage: %s <baseline.csv> <current.csv> [--tolerance=0.05] [--metric=min|median|p99|max] "
+            "[--noise-floor=1.0]\n",
+            argv[0]
+        );
+        return std::nullopt;
+    }
+
+    options.baseline = positional[0];
+    options.current  = positional[1];
+    return options;
+}
+
+}  // namespace
+
+auto main(int argc, char const* const* argv) -> int
+{
+    auto const options = parseOptions(argc, argv);
+    if (not options) {
+        return ExitCode::Error;
+    }
+
+    auto const baseline = readResults(options->baseline, options->metric);
+    auto const current  = readResults(options->current, options->metric);
+    if (not baseline or not current) {
+        return ExitCode::Error;
+    }
+
+    auto regressions  = 0;
+    auto improvements = 0;
+    auto compared     = 0;
+
+    for (auto const& [key, now] : *current) {
+        auto const found = baseline->find(key);
+        if (found == baseline->end()) {
+            std::printf("NEW        %-70s %12.3f ns\n", key.c_str(), now);
+            continue;
+        }
+
+        ++compared;
+        // A zero baseline has no relative tolerance, any slowdown above the noise floor regresses
+        auto const before = found->second;
+        auto const delta  = now - before;
+        auto const ratio  = before > 0.0 ? delta / before : std::numeric_limits<double>::infinity();
+
+        if (delta > options->noiseFloor and ratio > options->tolerance) {
+            ++regressions;
+            std::printf("REGRESSION %-70s %12.3f -> %12.3f ns (%+.1f %%)\n", key.c_str(), before, now, ratio * 100.0);
+        } else if (-delta > options->noiseFloor and -ratio > options->tolerance) {
+            ++improvements;
+            std::printf("IMPROVED   %-70s %12.3f -> %12.3f ns (%+.1f %%)\n", key.c_str(), before, now, ratio * 100.0);
+        }
+    }
+
+    for (auto const& [key, before] : *baseline) {
+        if (not current->contains(key)) {
+            std::printf("MISSING    %-70s %12.3f ns\n", key.c_str(), before);
+        }
+    }
+
+    std::printf(
+        "\n%d compared, %d regressed, %d improved (metric: %s, tolerance: %.1f %%, noise floor: %.1f ns)\n",
+        compared,
+        regressions,
+        improvements,
+        options->metric.c_str(),
+        options->tolerance * 100.0,
+        options->noiseFloor
+    );
+
+    return regressions > 0 ? ExitCode::Regression : ExitCode::Success;
+}
@@ -0,0 +1,82 @@
+// State footprint of every processor & module in the benchmark registry:
+// sizeof, alignof and the share of the 128 KiB DTCM of the STM32H750 on the
+// Daisy Patch SM. Measured on the host, only types holding pointers (e.g. the
+// wavetable of Kyma) are smaller on the 32-bit target. The firmware targets
+// enforce their budgets at compile time with GRIT_RAM_BUDGET, see
+// grit/core/footprint.hpp.
+//
+// Usage: grit-footprint [--format=text|csv] [filter]
+
+#include "registry.hpp"
+
+#include <grit/audio.hpp>
+#include <grit/core/footprint.hpp>
+#include <grit/eurorack.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+namespace {
+
+constexpr auto DtcmSize = 128.0 * 1024.0;
+
+/// False for the block & mono entries, they share the processor of an earlier entry.
+template<typename Entry, typename... Entries>
+constexpr auto isFirstEntryOfProcessor(TypeList<Entries...> /*registry*/) -> bool
+{
+    using Processor = typename Entry::BenchmarkType::ProcessorType;
+
+    auto before = true;
+    auto first  = true;
+    ((before = before and not etl::same_as<Entries, Entry>,
+      first  = first and not(before and etl::same_as<typename Entries::BenchmarkType::ProcessorType, Processor>)),
+     ...);
+    return first;
+}
+
+}  // namespace
+
+auto main(int argc, char const* const* argv) -> int
+{
+    auto csv    = false;
+    auto filter = std::string_view{};
+    for (auto i{1}; i < argc; ++i) {
+        auto const arg = std::string_view{argv[i]};
+        if (arg == "--format=csv") {
+            csv = true;
+        } else if (arg == "--format=text") {
+            csv = false;
+        } else if (arg.starts_with("--")) {
+            std::fprintf(stderr, "unknown option: %s\n", argv[i]);
+            return EXIT_FAILURE;
+        } else {
+            filter = arg;
+        }
+    }
+
+    if (csv) {
+        std::puts("name,size,alignment");
+    } else {
+        std::printf("%-26s %10s %6s %8s\n", "name", "size", "align", "dtcm");
+    }
+
+    forEachEntry(ProcessorRegistry{}, [=]<typename Entry> {
+        if constexpr (not isFirstEntryOfProcessor<Entry>(ProcessorRegistry{})) {
+            return;
+        }
+        if (not filter.empty() and std::string_view{Entry::name()}.find(filter) == std::string_view::npos) {
+            return;
+        }
+
+        auto const fp = grit::footprint<typename Entry::BenchmarkType::ProcessorType>;
+        if (csv) {
+            std::printf("%s,%zu,%zu\n", Entry::name(), fp.size, fp.alignment);
+        } else {
+            auto const dtcm = 100.0 * double(fp.size) / DtcmSize;
+            std::printf("%-26s %10zu %6zu %7.2f%%\n", Entry::name(), fp.size, fp.alignment, dtcm);
+        }
+    });
+
+    return EXIT_SUCCESS;
+}
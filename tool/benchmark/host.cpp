@@ -0,0 +1,329 @@
+#include "benchmarks.hpp"
+#include "registry.hpp"
+#include "report.hpp"
+
+#include <grit/core/profile.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+#if defined(__x86_64__) or defined(__i386__)
+    #include <x86intrin.h>
+#endif
+
+// Host build of the daisy benchmark. Runs the same suites, but each
+// repetition times a batch of calls with std::chrono::steady_clock. The batch
+// size is calibrated so that a single measurement is well above the clock
+// resolution. Repetitions further than 3 scaled MADs above the median are
+// rejected as outliers (preemption, interrupts, frequency changes). The p99
+// and max are taken from all repetitions, before outlier rejection.
+
+namespace host {
+
+using Clock = std::chrono::steady_clock;
+
+inline constexpr auto Repetitions  = 201;
+inline constexpr auto MinBatchTime = std::chrono::microseconds{20};
+inline constexpr auto MaxBatchSize = 1 << 20;
+
+inline auto filter   = std::string_view{};
+inline auto reporter = BenchmarkReporter{ReportFormat::Text, [](char const* line) { std::puts(line); }};
+
+/// Reference cycles (TSC) per nanosecond, 0 if the platform has no cycle counter.
+inline auto cyclesPerNanosecond = 0.0;
+
+struct Statistics
+{
+    double min{0.0};
+    double median{0.0};
+    double mean{0.0};
+    double p99{0.0};
+    double max{0.0};
+    int kept{0};
+    int total{0};
+};
+
+[[nodiscard]] auto median(std::array<double, Repetitions> runs, int count) -> double
+{
+    auto const mid = runs.begin() + count / 2;
+    std::nth_element(runs.begin(), mid, runs.begin() + count);
+    return *mid;
+}
+
+[[nodiscard]] auto summarize(std::array<double, Repetitions> const& runs) -> Statistics
+{
+    auto const center = median(runs, Repetitions);
+
+    auto deviations = std::array<double, Repetitions>{};
+    std::transform(runs.begin(), runs.end(), deviations.begin(), [=](auto x) { return std::abs(x - center); });
+    auto const mad   = median(deviations, Repetitions) * 1.4826;
+    auto const limit = center + 3.0 * std::max(mad, center * 1e-3);
+
+    auto kept  = std::array<double, Repetitions>{};
+    auto count = int(std::copy_if(runs.begin(), runs.end(), kept.begin(), [=](auto x) { return x <= limit; })
+                     - kept.begin());
+
+    auto sum = 0.0;
+    for (auto i{0}; i < count; ++i) {
+        sum += kept[size_t(i)];
+    }
+
+    auto all = runs;
+
+    return Statistics{
+        .min    = *std::min_element(kept.begin(), kept.begin() + count),
+        .median = median(kept, count),
+        .mean   = sum / double(count),
+        .p99    = quantile(all.begin(), all.end(), 0.99),
+        .max    = *std::max_element(runs.begin(), runs.end()),
+        .kept   = count,
+        .total  = Repetitions,
+    };
+}
+
+auto calibrateCycleCounter() -> void
+{
+#if defined(__x86_64__) or defined(__i386__)
+    auto const startTime   = Clock::now();
+    auto const startCycles = __rdtsc();
+    while (Clock::now() - startTime < std::chrono::milliseconds{50}) {}
+    auto const cycles  = double(__rdtsc() - startCycles);
+    auto const elapsed = std::chrono::duration<double, std::nano>{Clock::now() - startTime};
+    cyclesPerNanosecond = cycles / elapsed.count();
+#endif
+}
+
+[[nodiscard]] auto isText() -> bool { return reporter.format() == ReportFormat::Text; }
+
+/// Returns the duration of a single call in nanoseconds for each repetition.
+template<typename Func>
+[[nodiscard]] auto measure(Func func) -> std::array<double, Repetitions>
+{
+    auto const runBatch = [&func](int batch) {
+        auto const start = Clock::now();
+        for (auto i{0}; i < batch; ++i) {
+            func();
+        }
+        return Clock::now() - start;
+    };
+
+    auto batch = 1;
+    while (batch < MaxBatchSize and runBatch(batch) < MinBatchTime) {
+        batch *= 2;
+    }
+
+    auto runs = std::array<double, Repetitions>{};
+    for (auto& run : runs) {
+        auto const elapsed = std::chrono::duration<double, std::nano>{runBatch(batch)};
+        run                = elapsed.count() / double(batch);
+    }
+    return runs;
+}
+
+[[nodiscard]] auto isFilteredOut(char const* name) -> bool
+{
+    return not filter.empty() and std::string_view{name}.find(filter) == std::string_view::npos;
+}
+
+/// Accumulated GRIT_PROFILE_ZONE statistics of all benchmarks. Goes to stderr,
+/// to keep the csv & json output on stdout parseable.
+auto printProfileZones() -> void
+{
+    std::fflush(stdout);
+    std::fprintf(stderr, "\nProfile zones:\n");
+    grit::profile::forEachZone([](grit::profile::ZoneCounter const& zone) {
+        auto const perCall = zone.calls == 0 ? 0.0 : double(zone.ticks) / double(zone.calls);
+        std::fprintf(
+            stderr,
+            "%-24s Calls: %12u - Total: %12.3f ms - Average: %9.2f ns/call\n",
+            zone.name,
+            static_cast<unsigned>(zone.calls),
+            double(zone.ticks) * 1e3 / double(grit::SteadyClock::ticksPerSecond),
+            perCall * 1e9 / double(grit::SteadyClock::ticksPerSecond)
+        );
+    });
+}
+
+}  // namespace host
+
+template<int N, typename Benchmark>
+auto fftBench(char const* name, Benchmark bench)
+{
+    if (host::isFilteredOut(name)) {
+        return;
+    }
+
+    bench();
+    bench();
+    bench();
+
+    auto const stats = host::summarize(host::measure([&bench] { bench(); }));
+    auto const dsize = double(bench.size());
+
+    if (not host::isText()) {
+        host::reporter.add({
+            .kind            = "fft",
+            .name            = name,
+            .size            = int(bench.size()),
+            .sampleRate      = 0,
+            .min             = stats.min,
+            .median          = stats.median,
+            .p99             = stats.p99,
+            .max             = stats.max,
+            .cyclesPerSample = stats.median * host::cyclesPerNanosecond / dsize,
+        });
+        return;
+    }
+
+    std::printf(
+        "%-40s Size: %5d - Median: %10.1f ns - Min: %10.1f ns - Max: %10.1f ns - %7.2f ns/point - Kept: %3d/%d\n",
+        name,
+        int(bench.size()),
+        stats.median,
+        stats.min,
+        stats.max,
+        stats.median / dsize,
+        stats.kept,
+        stats.total
+    );
+}
+
+template<int BlockSize, typename Benchmark>
+auto audioBench(char const* name, float sampleRate, Benchmark bench) -> double
+{
+    if (host::isFilteredOut(name)) {
+        return 0.0;
+    }
+
+    auto rng              = etl::xoshiro128plusplus{14342};
+    auto const noiseLeft  = makeNoise<float, BlockSize>(rng);
+    auto const noiseRight = makeNoise<float, BlockSize>(rng);
+
+    auto buffer = etl::array<float, BlockSize * 2>{};
+    auto block  = grit::StereoBlock<float>{buffer.data(), buffer.size() / 2};
+
+    auto const fillWithNoise = [&] {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            block(0, i) = noiseLeft[i];
+            block(1, i) = noiseRight[i];
+        }
+        grit::doNotOptimize(buffer.front());
+    };
+
+    // The processors run in-place, so every call needs fresh input. The cost
+    // of the copy is measured separately and removed from the result.
+    auto const overhead = host::summarize(host::measure(fillWithNoise));
+    auto const stats    = host::summarize(host::measure([&] {
+        fillWithNoise();
+        bench(block);
+        grit::doNotOptimize(buffer.front());
+        grit::doNotOptimize(buffer.back());
+    }));
+
+    auto const median = std::max(stats.median - overhead.median, 0.0);
+    auto const min    = std::max(stats.min - overhead.median, 0.0);
+    auto const p99    = std::max(stats.p99 - overhead.median, 0.0);
+    auto const max    = std::max(stats.max - overhead.median, 0.0);
+
+    if (not host::isText()) {
+        host::reporter.add({
+            .kind            = "audio",
+            .name            = name,
+            .size            = BlockSize,
+            .sampleRate      = int(sampleRate),
+            .min             = min,
+            .median          = median,
+            .p99             = p99,
+            .max             = max,
+            .cyclesPerSample = median * host::cyclesPerNanosecond / double(BlockSize),
+        });
+        return median;
+    }
+
+    std::printf(
+        "%-24s Rate: %6d - Block: %3d - Median: %9.1f ns - Min: %9.1f ns - Max: %9.1f ns"
+        " - %7.2f ns/sample - Kept: %3d/%d\n",
+        name,
+        int(sampleRate),
+        BlockSize,
+        median,
+        min,
+        max,
+        median / double(BlockSize),
+        stats.kept,
+        stats.total
+    );
+
+    return median;
+}
+
+auto printBlockCost(char const* name, float sampleRate, BlockCost const& cost) -> void
+{
+    if (not host::isText() or host::isFilteredOut(name)) {
+        return;
+    }
+
+    std::printf(
+        "%-24s Rate: %6d - Overhead: %9.1f ns/block - Cost: %7.2f ns/sample - Load: %6.3f %%\n",
+        name,
+        int(sampleRate),
+        cost.perBlock,
+        cost.perSample,
+        cost.perSample * double(sampleRate) * 1e-7
+    );
+}
+
+auto printSeparator() -> void
+{
+    if (host::isText() and host::filter.empty()) {
+        std::printf("\n");
+    }
+}
+
+#include "suite.hpp"
+
+// Usage: grit-benchmark-host [--format=text|csv|json] [filter]
+auto main(int argc, char const* const* argv) -> int
+{
+    auto format = ReportFormat::Text;
+    for (auto i{1}; i < argc; ++i) {
+        auto const arg = std::string_view{argv[i]};
+        if (arg == "--format=csv") {
+            format = ReportFormat::Csv;
+        } else if (arg == "--format=json") {
+            format = ReportFormat::Json;
+        } else if (arg == "--format=text") {
+            format = ReportFormat::Text;
+        } else if (arg.starts_with("--")) {
+            std::fprintf(stderr, "unknown option: %s\n", argv[i]);
+            return EXIT_FAILURE;
+        } else {
+            host::filter = arg;
+        }
+    }
+
+#if not defined(__OPTIMIZE__)
+    std::fprintf(stderr, "WARNING: benchmark was built without optimizations\n");
+#endif
+
+    host::calibrateCycleCounter();
+    host::reporter = BenchmarkReporter{format, [](char const* line) { std::puts(line); }};
+    host::reporter.begin();
+
+    runAudioSuite();
+    runRegistrySuite();
+    runFftSuite();
+
+    host::reporter.end();
+
+#if GRIT_ENABLE_PROFILING
+    host::printProfileZones();
+#endif
+
+    return EXIT_SUCCESS;
+}
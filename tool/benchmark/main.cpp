@@ -1,58 +1,88 @@
-#include <grit/audio.hpp>
-#include <grit/core/benchmark.hpp>
-#include <grit/fft.hpp>
+#include "benchmarks.hpp"
+#include "registry.hpp"
+#include "report.hpp"
 
 #include <etl/algorithm.hpp>
 #include <etl/array.hpp>
-#include <etl/bit.hpp>
-#include <etl/chrono.hpp>
-#include <etl/functional.hpp>
-#include <etl/linalg.hpp>
+#include <etl/cstdint.hpp>
 #include <etl/numeric.hpp>
 #include <etl/random.hpp>
 
 #include <daisy_patch_sm.h>
 
-template<typename RealOrComplex, unsigned N>
-[[nodiscard]] auto makeNoise(auto& rng) -> etl::array<RealOrComplex, N>
-{
-    if constexpr (etl::floating_point<RealOrComplex>) {
-        using Float = RealOrComplex;
-        auto buf    = etl::array<Float, N>{};
-        auto dist   = etl::uniform_real_distribution<Float>{Float(-1.0), Float(1.0)};
-        auto gen    = [&rng, &dist] { return dist(rng); };
-        etl::generate(buf.begin(), buf.end(), gen);
-        return buf;
-    } else {
-        using Float = RealOrComplex::value_type;
-        auto buf    = etl::array<RealOrComplex, N>{};
-        auto dist   = etl::uniform_real_distribution<Float>{Float(-1.0), Float(1.0)};
-        auto gen    = [&rng, &dist] { return RealOrComplex{dist(rng), dist(rng)}; };
-        etl::generate(buf.begin(), buf.end(), gen);
-        return buf;
-    }
+namespace mcu {
+
+auto patch = daisy::patch_sm::DaisyPatchSM{};
+
+// Switch to ReportFormat::Text for the aligned, human readable output.
+auto reporter = BenchmarkReporter{
+    ReportFormat::Csv,
+    [](char const* line) { daisy::patch_sm::DaisyPatchSM::PrintLine("%s", line); },
 };
 
+[[nodiscard]] auto ticksToNanoseconds(double ticks) -> double
+{
+    return ticks * 1e9 / static_cast<double>(daisy::System::GetTickFreq());
+}
+
+[[nodiscard]] auto ticksToCycles(double ticks) -> double
+{
+    return ticks * static_cast<double>(daisy::System::GetSysClkFreq())
+         / static_cast<double>(daisy::System::GetTickFreq());
+}
+
+/// Reports the runs (in timer ticks) of a single benchmark. Returns the median in nanoseconds.
+template<etl::size_t Runs>
+auto report(char const* kind, char const* name, int size, float sampleRate, etl::array<etl::uint32_t, Runs>& runs)
+    -> double
+{
+    auto const median = static_cast<double>(quantile(runs.begin(), runs.end(), 0.5));
+    auto const p99    = static_cast<double>(quantile(runs.begin(), runs.end(), 0.99));
+    auto const min    = static_cast<double>(runs.front());
+    auto const max    = static_cast<double>(runs.back());
+
+    reporter.add({
+        .kind            = kind,
+        .name            = name,
+        .size            = size,
+        .sampleRate      = static_cast<int>(sampleRate),
+        .min             = ticksToNanoseconds(min),
+        .median          = ticksToNanoseconds(median),
+        .p99             = ticksToNanoseconds(p99),
+        .max             = ticksToNanoseconds(max),
+        .cyclesPerSample = ticksToCycles(median) / static_cast<double>(size),
+    });
+
+    return ticksToNanoseconds(median);
+}
+
+}  // namespace mcu
+
 template<int N, typename Benchmark>
 auto fftBench(char const* name, Benchmark bench)
 {
-    using Microseconds = etl::chrono::duration<float, etl::micro>;
-
-    auto runs = etl::array<float, N>{};
+    auto runs = etl::array<etl::uint32_t, N>{};
 
     bench();
     bench();
     bench();
 
     for (auto i{0U}; i < N; ++i) {
-        auto const start = daisy::System::GetUs();
+        auto const start = daisy::System::GetTick();
         bench();
-        auto const stop = daisy::System::GetUs();
+        auto const stop = daisy::System::GetTick();
+
+        runs[i] = stop - start;
+    }
 
-        runs[i] = etl::chrono::duration_cast<Microseconds>(etl::chrono::microseconds{stop - start}).count();
+    if (mcu::reporter.format() != ReportFormat::Text) {
+        static_cast<void>(mcu::report("fft", name, int(bench.size()), 0.0F, runs));
+        return;
     }
 
-    auto const average = int(etl::reduce(runs.begin(), end(runs), 0.0F) / static_cast<float>(runs.size()));
+    auto const toUs    = [](auto ticks) { return int(mcu::ticksToNanoseconds(double(ticks)) / 1000.0); };
+    auto const sum     = etl::reduce(runs.begin(), runs.end(), 0.0);
+    auto const average = int(mcu::ticksToNanoseconds(sum / double(N)) / 1000.0);
     auto const dsize   = double(bench.size());
     auto const mflops  = static_cast<int>(std::lround(5.0 * dsize * std::log2(dsize) / average)) * 2;
 
@@ -61,20 +91,18 @@ auto fftBench(char const* name, Benchmark bench)
         name,
         N,
         average,
-        int(*etl::min_element(runs.begin(), runs.end())),
-        int(*etl::max_element(runs.begin(), runs.end())),
+        toUs(*etl::min_element(runs.begin(), runs.end())),
+        toUs(*etl::max_element(runs.begin(), runs.end())),
         mflops
     );
 }
 
 template<int BlockSize, typename Benchmark>
-auto audioBench(char const* name, Benchmark bench)
+auto audioBench(char const* name, float sampleRate, Benchmark bench) -> double
 {
     static constexpr auto Runs = 128;
 
-    using Microseconds = etl::chrono::duration<float, etl::micro>;
-
-    auto runs = etl::array<float, Runs>{};
+    auto runs = etl::array<etl::uint32_t, Runs>{};
 
     auto rng              = etl::xoshiro128plusplus{14342};
     auto const noiseLeft  = makeNoise<float, BlockSize>(rng);
@@ -93,160 +121,61 @@ auto audioBench(char const* name, Benchmark bench)
     for (auto i{0U}; i < Runs; ++i) {
         fillWithNoise(block);
 
-        auto const start = daisy::System::GetUs();
+        auto const start = daisy::System::GetTick();
         bench(block);
-        auto const stop = daisy::System::GetUs();
+        auto const stop = daisy::System::GetTick();
 
         grit::doNotOptimize(buffer.front());
         grit::doNotOptimize(buffer.back());
 
-        runs[i] = etl::chrono::duration_cast<Microseconds>(etl::chrono::microseconds{stop - start}).count();
+        runs[i] = stop - start;
     }
 
-    auto const average = int(etl::reduce(runs.begin(), end(runs), 0.0F) / static_cast<float>(runs.size()));
+    if (mcu::reporter.format() != ReportFormat::Text) {
+        return mcu::report("audio", name, BlockSize, sampleRate, runs);
+    }
+
+    auto const toUs    = [](auto ticks) { return int(mcu::ticksToNanoseconds(double(ticks)) / 1000.0); };
+    auto const sum     = etl::reduce(runs.begin(), runs.end(), 0.0);
+    auto const average = mcu::ticksToNanoseconds(sum / double(Runs));
 
     daisy::patch_sm::DaisyPatchSM::PrintLine(
-        "%30s Block: %d - Runs: %4d - Average: %4d us - Min: %4d us - Max: %4d us\n",
+        "%30s Rate: %d - Block: %d - Runs: %4d - Average: %4d us - Min: %4d us - Max: %4d us\n",
         name,
+        int(sampleRate),
         BlockSize,
         Runs,
-        average,
-        int(*etl::min_element(runs.begin(), runs.end())),
-        int(*etl::max_element(runs.begin(), runs.end()))
+        int(average / 1000.0),
+        toUs(*etl::min_element(runs.begin(), runs.end())),
+        toUs(*etl::max_element(runs.begin(), runs.end()))
     );
-}
-
-struct c2c_dit2_v3
-{
-    c2c_dit2_v3() = default;
-
-    template<etl::linalg::inout_vector Vec>
-    auto operator()(Vec x, auto const& twiddles) const noexcept -> void
-    {
-        auto const size  = x.size();
-        auto const order = grit::ilog2(size);
-
-        {
-            // stage 0
-            static constexpr auto const stage_length = 1;  // grit::ipow<2>(0)
-            static constexpr auto const stride       = 2;  // grit::ipow<2>(0 + 1)
-
-            for (auto k{0}; k < static_cast<int>(size); k += stride) {
-                auto const i1 = k;
-                auto const i2 = k + stage_length;
-
-                auto const temp = x(i1) + x(i2);
-                x(i2)           = x(i1) - x(i2);
-                x(i1)           = temp;
-            }
-        }
-
-        for (auto stage{1ULL}; stage < order; ++stage) {
-
-            auto const stage_length = grit::ipow<2ULL>(stage);
-            auto const stride       = grit::ipow<2ULL>(stage + 1);
-            auto const tw_stride    = grit::ipow<2ULL>(order - stage - 1ULL);
-
-            for (auto k{0ULL}; k < size; k += stride) {
-                for (auto pair{0ULL}; pair < stage_length; ++pair) {
-                    auto const tw = twiddles(pair * tw_stride);
-
-                    auto const i1 = k + pair;
-                    auto const i2 = k + pair + stage_length;
-
-                    auto const temp = x(i1) + tw * x(i2);
-                    x(i2)           = x(i1) - tw * x(i2);
-                    x(i1)           = temp;
-                }
-            }
-        }
-    }
-};
-
-template<typename Float, int N, typename Kernel>
-struct ComplexRoundtrip
-{
-    ComplexRoundtrip() = default;
-
-    static constexpr auto size() { return N; }
-
-    auto operator()() -> void
-    {
-        auto x      = etl::mdspan<etl::complex<Float>, etl::extents<etl::size_t, N>>{_buf.data()};
-        auto w      = etl::mdspan<etl::complex<Float> const, etl::extents<etl::size_t, N / 2>>{_tw.data()};
-        auto kernel = Kernel{};
-
-        kernel(x, w);
-        kernel(x, etl::linalg::conjugated(w));
-        etl::linalg::scale(Float(1) / Float(N), x);
-
-        grit::doNotOptimize(_buf.front());
-        grit::doNotOptimize(_buf.back());
-    }
 
-private:
-    etl::array<etl::complex<Float>, N / 2> _tw{grit::fft::detail::makeTwiddles<Float, N>()};
-    etl::array<etl::complex<Float>, N> _buf{[] {
-        auto rng = etl::xoshiro128plusplus{42};
-        return makeNoise<etl::complex<Float>, N>(rng);
-    }()};
-};
+    return average;
+}
 
-template<typename Float, int N>
-struct StaticComplexRoundtrip
+auto printBlockCost(char const* name, float sampleRate, BlockCost const& cost) -> void
 {
-    StaticComplexRoundtrip() = default;
-
-    static constexpr auto size() { return N; }
-
-    auto operator()() -> void
-    {
-        auto x = etl::mdspan{_buf.data(), etl::extents<etl::size_t, N>{}};
-        _plan(x, grit::fft::Direction::Forward);
-        _plan(x, grit::fft::Direction::Backward);
-        etl::linalg::scale(Float(1) / Float(N), x);
-
-        grit::doNotOptimize(_buf.front());
-        grit::doNotOptimize(_buf.back());
+    if (mcu::reporter.format() != ReportFormat::Text) {
+        return;
     }
 
-private:
-    grit::fft::StaticComplexPlanV2<etl::complex<Float>, N> _plan{};
-    etl::array<etl::complex<Float>, N> _buf{[] {
-        auto rng = etl::xoshiro128plusplus{42};
-        return makeNoise<etl::complex<Float>, N>(rng);
-    }()};
-};
+    daisy::patch_sm::DaisyPatchSM::PrintLine(
+        "%30s Rate: %d - Overhead: %d ns/block - Cost: %d ns/sample\n",
+        name,
+        int(sampleRate),
+        int(cost.perBlock),
+        int(cost.perSample)
+    );
+}
 
-template<typename Processor>
-struct StereoProcessor
+auto printSeparator() -> void
 {
-    explicit StereoProcessor(float sampleRate)
-    {
-        if constexpr (requires { _left.setSampleRate(sampleRate); }) {
-            _left.setSampleRate(sampleRate);
-            _right.setSampleRate(sampleRate);
-        }
+    if (mcu::reporter.format() == ReportFormat::Text) {
+        daisy::patch_sm::DaisyPatchSM::PrintLine("");
     }
+}
 
-    auto operator()(grit::StereoBlock<float> const& block) -> void
-    {
-        for (auto i{0U}; i < block.extent(1); ++i) {
-            block(0, i) = _left(block(0, i));
-            block(1, i) = _right(block(1, i));
-        }
-    }
-
-private:
-    Processor _left;
-    Processor _right;
-};
-
-namespace mcu {
-
-auto patch = daisy::patch_sm::DaisyPatchSM{};
-
-}  // namespace mcu
+#include "suite.hpp"
 
 auto main() -> int
 {
@@ -255,40 +184,13 @@ auto main() -> int
     daisy::patch_sm::DaisyPatchSM::StartLog(true);
     daisy::patch_sm::DaisyPatchSM::PrintLine("Daisy Patch SM started. Test Beginning");
 
-    audioBench<16>("AirWindowsFireAmp:     ", StereoProcessor<grit::AirWindowsFireAmp<float>>{96'000.0F});
-    audioBench<16>("AirWindowsGrindAmp:    ", StereoProcessor<grit::AirWindowsGrindAmp<float>>{96'000.0F});
-    audioBench<16>("AirWindowsVinylDither: ", StereoProcessor<grit::AirWindowsVinylDither<float>>{96'000.0F});
-    daisy::patch_sm::DaisyPatchSM::PrintLine("");
-
-    audioBench<32>("AirWindowsFireAmp:     ", StereoProcessor<grit::AirWindowsFireAmp<float>>{96'000.0F});
-    audioBench<32>("AirWindowsGrindAmp:    ", StereoProcessor<grit::AirWindowsGrindAmp<float>>{96'000.0F});
-    audioBench<32>("AirWindowsVinylDither: ", StereoProcessor<grit::AirWindowsVinylDither<float>>{96'000.0F});
-    daisy::patch_sm::DaisyPatchSM::PrintLine("");
-
-    audioBench<64>("AirWindowsFireAmp:     ", StereoProcessor<grit::AirWindowsFireAmp<float>>{96'000.0F});
-    audioBench<64>("AirWindowsGrindAmp:    ", StereoProcessor<grit::AirWindowsGrindAmp<float>>{96'000.0F});
-    audioBench<64>("AirWindowsVinylDither: ", StereoProcessor<grit::AirWindowsVinylDither<float>>{96'000.0F});
-    daisy::patch_sm::DaisyPatchSM::PrintLine("");
-
-    // fftBench<64>("ComplexRoundtrip<float, 16, v3>      - ", ComplexRoundtrip<float, 16, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 32, v3>      - ", ComplexRoundtrip<float, 32, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 64, v3>      - ", ComplexRoundtrip<float, 64, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 128, v3>     - ", ComplexRoundtrip<float, 128, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 256, v3>     - ", ComplexRoundtrip<float, 256, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 512, v3>     - ", ComplexRoundtrip<float, 512, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 1024, v3>    - ", ComplexRoundtrip<float, 1024, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 2048, v3>    - ", ComplexRoundtrip<float, 2048, c2c_dit2_v3>{});
-    // fftBench<64>("ComplexRoundtrip<float, 4096, v3>    - ", ComplexRoundtrip<float, 4096, c2c_dit2_v3>{});
-    // daisy::patch_sm::DaisyPatchSM::PrintLine("");
-
-    // fftBench<64>("StaticComplexRoundtrip<float, 64>   - ", StaticComplexRoundtrip<float, 64>{});
-    // fftBench<64>("StaticComplexRoundtrip<float, 128>  - ", StaticComplexRoundtrip<float, 128>{});
-    // fftBench<64>("StaticComplexRoundtrip<float, 256>  - ", StaticComplexRoundtrip<float, 256>{});
-    // fftBench<64>("StaticComplexRoundtrip<float, 512>  - ", StaticComplexRoundtrip<float, 512>{});
-    // fftBench<64>("StaticComplexRoundtrip<float, 1024> - ", StaticComplexRoundtrip<float, 1024>{});
-    // fftBench<64>("StaticComplexRoundtrip<float, 2048> - ", StaticComplexRoundtrip<float, 2048>{});
-    // fftBench<64>("StaticComplexRoundtrip<float, 4096> - ", StaticComplexRoundtrip<float, 4096>{});
-    // daisy::patch_sm::DaisyPatchSM::PrintLine("");
+    mcu::reporter.begin();
+
+    runAudioSuite();
+    // runRegistrySuite();
+    // runFftSuite();
+
+    mcu::reporter.end();
 
     while (true) {}
 }
@@ -0,0 +1,130 @@
+#include "perf_counters.hpp"
+#include "registry.hpp"
+#include "stimulus.hpp"
+
+#include <grit/core/benchmark.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#if not defined(GRIT_PERF_BUDGETS)
+    #define GRIT_PERF_BUDGETS "tool/benchmark/perf_budgets.csv"
+#endif
+
+namespace {
+
+constexpr auto SampleRate    = 48'000.0F;
+constexpr auto BlockSize     = 32;
+constexpr auto WarmupBlocks  = 64;
+constexpr auto MeasureBlocks = 256;
+
+struct PerSample
+{
+    double instructions{0.0};
+    double cycles{0.0};
+    double branchMisses{0.0};
+    double l1dMisses{0.0};
+};
+
+/// Name to instructions per stereo sample frame. Lines starting with '#' are comments.
+auto readBudgets(char const* path) -> std::map<std::string, double>
+{
+    auto budgets = std::map<std::string, double>{};
+    auto file    = std::ifstream{path};
+    auto line    = std::string{};
+
+    // Skip comments & the header
+    while (std::getline(file, line) and (line.empty() or line.front() == '#')) {}
+
+    while (std::getline(file, line)) {
+        auto const comma = line.find(',');
+        if (line.empty() or line.front() == '#' or comma == std::string::npos) {
+            continue;
+        }
+        budgets[line.substr(0, comma)] = std::strtod(line.c_str() + comma + 1, nullptr);
+    }
+
+    return budgets;
+}
+
+/// The counters only run during the block call, not while filling the input.
+template<typename Benchmark>
+auto measure(PerfCounters& counters) -> PerSample
+{
+    auto bench  = Benchmark{SampleRate, BlockSize};
+    auto buffer = std::vector<float>(BlockSize * 2);
+    auto block  = grit::StereoBlock<float>{buffer.data(), BlockSize};
+    auto rng    = StimulusRng{14342};
+
+    counters.reset();
+    for (auto b{0}; b < WarmupBlocks + MeasureBlocks; ++b) {
+        for (auto i{0}; i < BlockSize; ++i) {
+            block(0, i) = stimulus::noise(rng, 0, 0);
+            block(1, i) = stimulus::noise(rng, 0, 0);
+        }
+
+        if (b == WarmupBlocks) {
+            counters.reset();
+        }
+
+        counters.start();
+        bench(block);
+        counters.stop();
+
+        grit::doNotOptimize(buffer.front());
+        grit::doNotOptimize(buffer.back());
+    }
+
+    auto const counts  = counters.read();
+    auto const samples = double(MeasureBlocks * BlockSize);
+    return {
+        .instructions = double(counts.instructions) / samples,
+        .cycles       = double(counts.cycles) / samples,
+        .branchMisses = double(counts.branchMisses) / samples,
+        .l1dMisses    = double(counts.l1dMisses) / samples,
+    };
+}
+
+}  // namespace
+
+TEST_CASE("benchmark: instruction budget")
+{
+#if not defined(__OPTIMIZE__)
+    SKIP("budgets are only valid for optimized builds");
+#endif
+
+    auto counters = PerfCounters{};
+    if (not counters.isAvailable()) {
+        SKIP("hardware performance counters unavailable: " << counters.error());
+    }
+
+    auto const budgets = readBudgets(GRIT_PERF_BUDGETS);
+    REQUIRE_FALSE(budgets.empty());
+
+    std::printf("%-24s %12s %12s %12s %12s %12s\n", "per sample", "budget", "instr", "cycles", "br-miss", "l1d-miss");
+    forEachEntry(ProcessorRegistry{}, [&]<typename Entry> {
+        auto const found = budgets.find(Entry::name());
+        auto const count = measure<typename Entry::BenchmarkType>(counters);
+        auto const limit = found != budgets.end() ? found->second : 0.0;
+
+        std::printf(
+            "%-24s %12.1f %12.1f %12.1f %12.3f %12.3f\n",
+            Entry::name(),
+            limit,
+            count.instructions,
+            count.cycles,
+            count.branchMisses,
+            count.l1dMisses
+        );
+
+        INFO(Entry::name() << ": " << count.instructions << " instructions per sample, budget " << limit);
+        CHECK(found != budgets.end());
+        CHECK(count.instructions <= limit);
+    });
+}
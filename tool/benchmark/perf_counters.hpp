@@ -0,0 +1,128 @@
+#pragma once
+
+// Hardware performance counters via perf_event_open, Linux only. Counts user
+// space events of the calling thread. Instructions retired is the group leader,
+// the other events are optional and read as zero if the PMU (or the VM) does
+// not provide them. On other platforms, or without permission (see
+// /proc/sys/kernel/perf_event_paranoid), isAvailable() returns false.
+
+#include <array>
+#include <cstdint>
+
+#if defined(__linux__)
+    #include <cerrno>
+    #include <cstring>
+
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+struct PerfCounts
+{
+    std::uint64_t instructions{0};
+    std::uint64_t cycles{0};
+    std::uint64_t branchMisses{0};
+    std::uint64_t l1dMisses{0};
+};
+
+#if defined(__linux__)
+
+struct PerfCounters
+{
+    PerfCounters()
+    {
+        static constexpr auto l1dReadMiss = std::uint64_t(PERF_COUNT_HW_CACHE_L1D)
+                                          | (std::uint64_t(PERF_COUNT_HW_CACHE_OP_READ) << 8U)
+                                          | (std::uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16U);
+
+        _fds[0] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1);
+        if (_fds[0] == -1) {
+            _error = std::strerror(errno);
+            return;
+        }
+
+        _fds[1] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, _fds[0]);
+        _fds[2] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, _fds[0]);
+        _fds[3] = open(PERF_TYPE_HW_CACHE, l1dReadMiss, _fds[0]);
+    }
+
+    ~PerfCounters()
+    {
+        for (auto const fd : _fds) {
+            if (fd != -1) {
+                ::close(fd);
+            }
+        }
+    }
+
+    PerfCounters(PerfCounters const& other)                    = delete;
+    PerfCounters(PerfCounters&& other)                         = delete;
+    auto operator=(PerfCounters const& other) -> PerfCounters& = delete;
+    auto operator=(PerfCounters&& other) -> PerfCounters&      = delete;
+
+    [[nodiscard]] auto isAvailable() const -> bool { return _fds[0] != -1; }
+
+    /// Reason why the counters are unavailable.
+    [[nodiscard]] auto error() const -> char const* { return _error; }
+
+    auto reset() -> void { ::ioctl(_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP); }
+    auto start() -> void { ::ioctl(_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP); }
+    auto stop() -> void { ::ioctl(_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP); }
+
+    [[nodiscard]] auto read() const -> PerfCounts
+    {
+        auto counts = PerfCounts{};
+        if (not isAvailable()) {
+            return counts;
+        }
+
+        auto const value = [this](int index) -> std::uint64_t {
+            auto result = std::uint64_t{0};
+            if (_fds[index] == -1 or ::read(_fds[index], &result, sizeof(result)) != sizeof(result)) {
+                return 0;
+            }
+            return result;
+        };
+
+        counts.instructions = value(0);
+        counts.cycles       = value(1);
+        counts.branchMisses = value(2);
+        counts.l1dMisses    = value(3);
+        return counts;
+    }
+
+private:
+    [[nodiscard]] static auto open(std::uint32_t type, std::uint64_t config, int group) -> int
+    {
+        auto attr           = perf_event_attr{};
+        attr.size           = sizeof(perf_event_attr);
+        attr.type           = type;
+        attr.config         = config;
+        attr.disabled       = group == -1 ? 1U : 0U;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+
+        return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+    }
+
+    std::array<int, 4> _fds{-1, -1, -1, -1};
+    char const* _error{""};
+};
+
+#else
+
+struct PerfCounters
+{
+    [[nodiscard]] auto isAvailable() const -> bool { return false; }
+    [[nodiscard]] auto error() const -> char const* { return "perf_event_open is only supported on linux"; }
+
+    auto reset() -> void {}
+    auto start() -> void {}
+    auto stop() -> void {}
+
+    [[nodiscard]] auto read() const -> PerfCounts { return {}; }
+};
+
+#endif
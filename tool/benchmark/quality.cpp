@@ -0,0 +1,293 @@
+// Quality against cost of the approximations in grit. Every entry is driven
+// with a sine at several frequencies (or, for oscillators, tuned to them) and
+// the output is analysed with a Blackman-Harris windowed grit::fft::StaticRealPlan.
+//
+// The test frequencies are snapped to odd FFT bins, so the harmonics folded
+// back from above nyquist never land on the bins of an in-band harmonic. For
+// such a coherent tone the 4-term window spreads the energy over exactly +-3
+// bins. The energy of the spectrum is split into:
+//
+//  - fundamental: the bins around the test frequency
+//  - harmonics: the bins around the in-band harmonics (intended distortion)
+//  - aliasing: the bins around the harmonics above nyquist, folded back
+//  - noise: everything else, except DC
+//
+// The signal is the fundamental plus the in-band harmonics, a rectifier has
+// almost no fundamental. SNR is signal/noise, aliasing is relative to the whole
+// output except DC. THD+N is everything except DC relative to the fundamental.
+//
+// Usage: grit-benchmark-quality [--rate=48000] [filter]
+
+#include "registry.hpp"
+
+#include <grit/audio.hpp>
+#include <grit/core/benchmark.hpp>
+#include <grit/fft/static_real_plan.hpp>
+#include <grit/fft/window.hpp>
+
+#include <etl/complex.hpp>
+#include <etl/mdspan.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto FftSize       = std::size_t{8192};
+constexpr auto MainLobe      = std::size_t{3};
+constexpr auto MaxHarmonic   = std::size_t{128};
+constexpr auto TestFrequency = std::array<double, 7>{100.0, 1'000.0, 2'500.0, 5'000.0, 7'500.0, 10'000.0, 15'000.0};
+
+/// Memoryless waveshaper, the input is scaled by Drive.
+template<typename Processor, float Drive>
+struct Shaper
+{
+    explicit Shaper(float sampleRate) { prepareProcessor(_processor, sampleRate); }
+
+    auto operator()(float in) -> float { return _processor(in * Drive); }
+
+private:
+    Processor _processor{makeProcessor<Processor>()};
+};
+
+/// Effect with memory, e.g. filters & amp simulations, driven at Level.
+template<typename Processor, float Level>
+struct Effect
+{
+    explicit Effect(float sampleRate) { prepareProcessor(_processor, sampleRate); }
+
+    auto operator()(float in) -> float { return _processor(in * Level); }
+
+private:
+    Processor _processor{makeProcessor<Processor>()};
+};
+
+/// Oscillator tuned to the test frequency, the input is ignored.
+template<typename Oscillator, grit::OscillatorShape Shape = grit::OscillatorShape::Sine>
+struct Generator
+{
+    explicit Generator(float sampleRate)
+    {
+        prepareProcessor(_oscillator, sampleRate);
+        if constexpr (requires { _oscillator.setShape(Shape); }) {
+            _oscillator.setShape(Shape);
+        }
+    }
+
+    auto setFrequency(float frequency) -> void { _oscillator.setFrequency(frequency); }
+
+    auto operator()(float /*in*/) -> float { return _oscillator(); }
+
+private:
+    Oscillator _oscillator{makeProcessor<Oscillator>()};
+};
+
+using QualityRegistry = TypeList<
+    RegistryEntry<"TanhClipper x4", Shaper<grit::TanhClipper<float>, 4.0F>>,
+    RegistryEntry<"TanhClipperADAA1 x4", Shaper<grit::TanhClipperADAA1<float>, 4.0F>>,
+    RegistryEntry<"HardClipper x2", Shaper<grit::HardClipper<float>, 2.0F>>,
+    RegistryEntry<"HardClipperADAA1 x2", Shaper<grit::HardClipperADAA1<float>, 2.0F>>,
+    RegistryEntry<"FullWaveRectifier", Shaper<grit::FullWaveRectifier<float>, 1.0F>>,
+    RegistryEntry<"FullWaveRectifierADAA1", Shaper<grit::FullWaveRectifierADAA1<float>, 1.0F>>,
+    RegistryEntry<"HalfWaveRectifier", Shaper<grit::HalfWaveRectifier<float>, 1.0F>>,
+    RegistryEntry<"HalfWaveRectifierADAA1", Shaper<grit::HalfWaveRectifierADAA1<float>, 1.0F>>,
+    RegistryEntry<"DiodeRectifier", Shaper<grit::DiodeRectifier<float>, 1.0F>>,
+    RegistryEntry<"DiodeRectifierADAA1", Shaper<grit::DiodeRectifierADAA1<float>, 1.0F>>,
+    RegistryEntry<"AirWindowsFireAmp", Effect<grit::AirWindowsFireAmp<float>, 0.5F>>,
+    RegistryEntry<"AirWindowsGrindAmp", Effect<grit::AirWindowsGrindAmp<float>, 0.5F>>,
+    RegistryEntry<"Oscillator Sine", Generator<grit::Oscillator<float>>>,
+    RegistryEntry<"Oscillator Triangle", Generator<grit::Oscillator<float>, grit::OscillatorShape::Triangle>>,
+    RegistryEntry<"Oscillator Square", Generator<grit::Oscillator<float>, grit::OscillatorShape::Square>>,
+    RegistryEntry<"WavetableOscillator Sine", Generator<SineWavetableOscillator>>>;
+
+struct Quality
+{
+    double frequency{0.0};
+    double snr{0.0};
+    double thdN{0.0};
+    double aliasing{0.0};
+    double nsPerSample{0.0};
+};
+
+enum struct BinKind
+{
+    Noise,
+    Dc,
+    Fundamental,
+    Harmonic,
+    Alias,
+};
+
+[[nodiscard]] auto toDecibels(double ratio) -> double { return 10.0 * std::log10(std::max(ratio, 1e-30)); }
+
+/// Bin of harmonic*fundamental after folding at nyquist.
+[[nodiscard]] auto foldedBin(std::size_t bin) -> std::size_t
+{
+    bin %= FftSize;
+    return bin > FftSize / 2 ? FftSize - bin : bin;
+}
+
+auto markLobe(std::vector<BinKind>& kinds, std::size_t center, BinKind kind) -> void
+{
+    auto const first = center > MainLobe ? center - MainLobe : 0;
+    auto const last  = std::min(center + MainLobe, kinds.size() - 1);
+    for (auto k = first; k <= last; ++k) {
+        if (kinds[k] == BinKind::Noise) {
+            kinds[k] = kind;
+        }
+    }
+}
+
+[[nodiscard]] auto analyze(std::vector<double> const& signal, std::size_t fundamental) -> Quality
+{
+    using Plan = grit::fft::StaticRealPlan<double, FftSize>;
+
+    static auto const window = grit::fft::makeWindow<double, FftSize>(grit::fft::Window::BlackmanHarris);
+    static auto plan         = Plan{};
+
+    auto windowed = std::vector<double>(FftSize);
+    auto bins     = std::vector<etl::complex<double>>(Plan::numBins());
+    for (auto i = std::size_t{0}; i < FftSize; ++i) {
+        windowed[i] = signal[i] * window[i];
+    }
+
+    plan(
+        etl::mdspan{windowed.data(), etl::extents{windowed.size()}},
+        etl::mdspan{bins.data(), etl::extents{bins.size()}}
+    );
+
+    auto kinds = std::vector<BinKind>(bins.size(), BinKind::Noise);
+    markLobe(kinds, 0, BinKind::Dc);
+    markLobe(kinds, fundamental, BinKind::Fundamental);
+    for (auto h = std::size_t{2}; h <= MaxHarmonic; ++h) {
+        auto const bin = h * fundamental;
+        markLobe(kinds, foldedBin(bin), bin <= FftSize / 2 ? BinKind::Harmonic : BinKind::Alias);
+    }
+
+    auto energy = std::array<double, 5>{};
+    for (auto k = std::size_t{0}; k < bins.size(); ++k) {
+        energy[std::size_t(kinds[k])] += bins[k].real() * bins[k].real() + bins[k].imag() * bins[k].imag();
+    }
+
+    auto const fund     = std::max(energy[std::size_t(BinKind::Fundamental)], 1e-300);
+    auto const noise    = energy[std::size_t(BinKind::Noise)];
+    auto const harmonic = energy[std::size_t(BinKind::Harmonic)];
+    auto const alias    = energy[std::size_t(BinKind::Alias)];
+
+    return Quality{
+        .snr      = toDecibels((fund + harmonic) / std::max(noise, 1e-300)),
+        .thdN     = toDecibels((noise + harmonic + alias) / fund),
+        .aliasing = toDecibels(alias / (fund + harmonic + alias + noise)),
+    };
+}
+
+template<typename Path>
+[[nodiscard]] auto measure(float sampleRate, double frequency) -> Quality
+{
+    // Odd bin, see comment at the top
+    auto const bin   = static_cast<std::size_t>(std::lround(frequency * double(FftSize) / double(sampleRate))) | 1U;
+    auto const exact = double(bin) * double(sampleRate) / double(FftSize);
+    auto const delta = 2.0 * 3.14159265358979323846 * exact / double(sampleRate);
+
+    auto path = Path{sampleRate};
+    if constexpr (requires { path.setFrequency(1.0F); }) {
+        path.setFrequency(static_cast<float>(exact));
+    }
+
+    // The first block lets filters & smoothers settle, the second is analysed.
+    auto output = std::vector<double>(FftSize);
+    auto input  = std::vector<float>(FftSize * 2);
+    for (auto i = std::size_t{0}; i < input.size(); ++i) {
+        input[i] = static_cast<float>(std::sin(delta * double(i)));
+    }
+
+    auto const start = Clock::now();
+    for (auto i = std::size_t{0}; i < FftSize; ++i) {
+        auto settle = path(input[i]);
+        grit::doNotOptimize(settle);
+    }
+    for (auto i = std::size_t{0}; i < FftSize; ++i) {
+        output[i] = path(input[FftSize + i]);
+    }
+    auto const stop = Clock::now();
+
+    auto result        = analyze(output, bin);
+    result.frequency   = exact;
+    result.nsPerSample = std::chrono::duration<double, std::nano>{stop - start}.count() / double(FftSize * 2);
+    return result;
+}
+
+}  // namespace
+
+auto main(int argc, char const* const* argv) -> int
+{
+#if not defined(__OPTIMIZE__)
+    std::fprintf(stderr, "WARNING: benchmark was built without optimizations\n");
+#endif
+
+    auto sampleRate = 48'000.0F;
+    auto filter     = std::string_view{};
+    for (auto i{1}; i < argc; ++i) {
+        auto const arg = std::string_view{argv[i]};
+        if (arg.starts_with("--rate=")) {
+            sampleRate = std::strtof(argv[i] + 7, nullptr);
+        } else if (arg.starts_with("--")) {
+            std::fprintf(stderr, "unknown option: %s\n", argv[i]);
+            return EXIT_FAILURE;
+        } else {
+            filter = arg;
+        }
+    }
+
+    std::printf("Rate: %d - FFT: %zu - Window: Blackman-Harris\n\n", int(sampleRate), FftSize);
+
+    forEachEntry(QualityRegistry{}, [=]<typename Entry> {
+        if (not filter.empty() and std::string_view{Entry::name()}.find(filter) == std::string_view::npos) {
+            return;
+        }
+
+        auto worst = Quality{.snr = 1e300, .thdN = -1e300, .aliasing = -1e300};
+        auto costs = std::vector<double>{};
+        for (auto const frequency : TestFrequency) {
+            if (frequency >= double(sampleRate) * 0.5) {
+                continue;
+            }
+
+            auto const q = measure<typename Entry::BenchmarkType>(sampleRate, frequency);
+            std::printf(
+                "%-26s %8.1f Hz - SNR: %7.1f dB - THD+N: %7.1f dB - Aliasing: %7.1f dB - %7.2f ns/sample\n",
+                Entry::name(),
+                q.frequency,
+                q.snr,
+                q.thdN,
+                q.aliasing,
+                q.nsPerSample
+            );
+
+            worst.snr      = std::min(worst.snr, q.snr);
+            worst.thdN     = std::max(worst.thdN, q.thdN);
+            worst.aliasing = std::max(worst.aliasing, q.aliasing);
+            costs.push_back(q.nsPerSample);
+        }
+
+        std::nth_element(costs.begin(), costs.begin() + std::ptrdiff_t(costs.size() / 2), costs.end());
+        std::printf(
+            "%-26s  Worst - SNR: %7.1f dB - THD+N: %7.1f dB - Aliasing: %7.1f dB - %7.2f ns/sample\n\n",
+            Entry::name(),
+            worst.snr,
+            worst.thdN,
+            worst.aliasing,
+            costs[costs.size() / 2]
+        );
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,255 @@
+#include "realtime_guard.hpp"
+
+#include <atomic>
+#include <cfenv>
+#include <cstddef>
+#include <new>
+
+#include <dlfcn.h>
+#include <pthread.h>
+
+#if defined(__SSE__)
+    #include <xmmintrin.h>
+#endif
+
+#if not defined(__GLIBC__)
+    #error "realtime_guard.cpp forwards to the glibc allocator"
+#endif
+
+// glibc exports its allocator under these names, so the replacements can
+// forward to it without dlsym, which may allocate itself.
+extern "C" {
+auto __libc_malloc(std::size_t size) -> void*;
+auto __libc_calloc(std::size_t count, std::size_t size) -> void*;
+auto __libc_realloc(void* ptr, std::size_t size) -> void*;
+auto __libc_memalign(std::size_t alignment, std::size_t size) -> void*;
+auto __libc_free(void* ptr) -> void;
+}
+
+namespace realtime {
+namespace {
+
+thread_local constinit auto isActive = false;
+
+constinit auto violationCount = std::atomic<std::uint32_t>{0};
+constinit auto firstViolation = std::atomic<char const*>{nullptr};
+
+using MutexFunction = int (*)(pthread_mutex_t*);
+
+/// Calls through the next definition of a mutex function. It's looked up on
+/// first use or at startup, whichever comes first, so never inside a scope.
+/// Racing threads resolve the same address.
+auto forward(MutexFunction& function, char const* symbol, pthread_mutex_t* mutex) -> int
+{
+    if (function == nullptr) {
+        function = reinterpret_cast<MutexFunction>(::dlsym(RTLD_NEXT, symbol));  // NOLINT
+    }
+    return function(mutex);
+}
+
+constinit auto nextMutexLock    = MutexFunction{nullptr};
+constinit auto nextMutexTrylock = MutexFunction{nullptr};
+constinit auto nextMutexUnlock  = MutexFunction{nullptr};
+
+[[gnu::constructor]] auto resolveMutexFunctions() -> void
+{
+    auto mutex = pthread_mutex_t{};
+    ::pthread_mutex_init(&mutex, nullptr);
+    ::pthread_mutex_lock(&mutex);
+    ::pthread_mutex_trylock(&mutex);
+    ::pthread_mutex_unlock(&mutex);
+    ::pthread_mutex_destroy(&mutex);
+}
+
+auto check(char const* function) -> void
+{
+    if (not isActive) {
+        return;
+    }
+
+    violationCount.fetch_add(1, std::memory_order_relaxed);
+
+    auto expected = static_cast<char const*>(nullptr);
+    firstViolation.compare_exchange_strong(expected, function, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+RealtimeScope::RealtimeScope() { isActive = true; }
+
+RealtimeScope::~RealtimeScope() { isActive = false; }
+
+auto violations() -> Violations
+{
+    return {
+        .count = violationCount.load(std::memory_order_relaxed),
+        .first = firstViolation.load(std::memory_order_relaxed),
+    };
+}
+
+auto resetViolations() -> void
+{
+    violationCount.store(0, std::memory_order_relaxed);
+    firstViolation.store(nullptr, std::memory_order_relaxed);
+}
+
+auto clearFloatingPointFlags() -> void
+{
+    std::feclearexcept(FE_ALL_EXCEPT);
+#if defined(__SSE__)
+    _mm_setcsr(_mm_getcsr() & ~static_cast<unsigned>(_MM_EXCEPT_DENORM));
+#endif
+}
+
+auto readFloatingPointFlags() -> FloatingPointFlags
+{
+    auto flags = FloatingPointFlags{
+        .invalid      = std::fetestexcept(FE_INVALID) != 0,
+        .divideByZero = std::fetestexcept(FE_DIVBYZERO) != 0,
+        .overflow     = std::fetestexcept(FE_OVERFLOW) != 0,
+        .underflow    = std::fetestexcept(FE_UNDERFLOW) != 0,
+    };
+
+#if defined(__SSE__)
+    flags.denormalOperand = (_mm_getcsr() & _MM_EXCEPT_DENORM) != 0;
+#endif
+
+    return flags;
+}
+
+}  // namespace realtime
+
+extern "C" {
+
+auto malloc(std::size_t size) -> void*
+{
+    realtime::check("malloc");
+    return __libc_malloc(size);
+}
+
+auto calloc(std::size_t count, std::size_t size) -> void*
+{
+    realtime::check("calloc");
+    return __libc_calloc(count, size);
+}
+
+auto realloc(void* ptr, std::size_t size) -> void*
+{
+    realtime::check("realloc");
+    return __libc_realloc(ptr, size);
+}
+
+auto free(void* ptr) -> void
+{
+    if (ptr != nullptr) {
+        realtime::check("free");
+    }
+    __libc_free(ptr);
+}
+
+auto pthread_mutex_lock(pthread_mutex_t* mutex) -> int
+{
+    realtime::check("pthread_mutex_lock");
+    return realtime::forward(realtime::nextMutexLock, "pthread_mutex_lock", mutex);
+}
+
+auto pthread_mutex_trylock(pthread_mutex_t* mutex) -> int
+{
+    realtime::check("pthread_mutex_trylock");
+    return realtime::forward(realtime::nextMutexTrylock, "pthread_mutex_trylock", mutex);
+}
+
+auto pthread_mutex_unlock(pthread_mutex_t* mutex) -> int
+{
+    realtime::check("pthread_mutex_unlock");
+    return realtime::forward(realtime::nextMutexUnlock, "pthread_mutex_unlock", mutex);
+}
+}
+
+namespace {
+
+auto allocate(std::size_t size, char const* function) -> void*
+{
+    realtime::check(function);
+    if (auto* ptr = __libc_malloc(size == 0 ? 1 : size); ptr != nullptr) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+auto allocateAligned(std::size_t size, std::align_val_t alignment, char const* function) -> void*
+{
+    realtime::check(function);
+    if (auto* ptr = __libc_memalign(static_cast<std::size_t>(alignment), size == 0 ? 1 : size); ptr != nullptr) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+auto deallocate(void* ptr, char const* function) -> void
+{
+    if (ptr != nullptr) {
+        realtime::check(function);
+    }
+    __libc_free(ptr);
+}
+
+}  // namespace
+
+// NOLINTBEGIN(misc-new-delete-overloads)
+
+auto operator new(std::size_t size) -> void* { return allocate(size, "operator new"); }
+
+auto operator new[](std::size_t size) -> void* { return allocate(size, "operator new[]"); }
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void*
+{
+    return allocateAligned(size, alignment, "operator new");
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void*
+{
+    return allocateAligned(size, alignment, "operator new[]");
+}
+
+auto operator new(std::size_t size, std::nothrow_t const& /*tag*/) noexcept -> void*
+{
+    realtime::check("operator new");
+    return __libc_malloc(size == 0 ? 1 : size);
+}
+
+auto operator new[](std::size_t size, std::nothrow_t const& /*tag*/) noexcept -> void*
+{
+    realtime::check("operator new[]");
+    return __libc_malloc(size == 0 ? 1 : size);
+}
+
+auto operator delete(void* ptr) noexcept -> void { deallocate(ptr, "operator delete"); }
+
+auto operator delete[](void* ptr) noexcept -> void { deallocate(ptr, "operator delete[]"); }
+
+auto operator delete(void* ptr, std::size_t /*size*/) noexcept -> void { deallocate(ptr, "operator delete"); }
+
+auto operator delete[](void* ptr, std::size_t /*size*/) noexcept -> void { deallocate(ptr, "operator delete[]"); }
+
+auto operator delete(void* ptr, std::align_val_t /*alignment*/) noexcept -> void
+{
+    deallocate(ptr, "operator delete");
+}
+
+auto operator delete[](void* ptr, std::align_val_t /*alignment*/) noexcept -> void
+{
+    deallocate(ptr, "operator delete[]");
+}
+
+auto operator delete(void* ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept -> void
+{
+    deallocate(ptr, "operator delete");
+}
+
+auto operator delete[](void* ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept -> void
+{
+    deallocate(ptr, "operator delete[]");
+}
+
+// NOLINTEND(misc-new-delete-overloads)
@@ -0,0 +1,52 @@
+#pragma once
+
+// Real-time safety checks for host tests. realtime_guard.cpp replaces malloc,
+// free, the global operator new & delete and the pthread mutex functions of
+// the executable. While a RealtimeScope is alive on the calling thread, every
+// call is recorded as a violation. Calls are still forwarded to glibc, so the
+// test keeps running and can report all offenders. Only works with glibc and
+// conflicts with the allocator interposition of sanitizers.
+
+#include <cstdint>
+
+namespace realtime {
+
+struct Violations
+{
+    std::uint32_t count{0};
+
+    /// Name of the first offending function, e.g. "operator new"
+    char const* first{nullptr};
+};
+
+/// Records violations on the calling thread until destroyed. Not nestable.
+struct RealtimeScope
+{
+    RealtimeScope();
+    ~RealtimeScope();
+
+    RealtimeScope(RealtimeScope const& other)                    = delete;
+    RealtimeScope(RealtimeScope&& other)                         = delete;
+    auto operator=(RealtimeScope const& other) -> RealtimeScope& = delete;
+    auto operator=(RealtimeScope&& other) -> RealtimeScope&      = delete;
+};
+
+/// Violations since the last call to resetViolations().
+[[nodiscard]] auto violations() -> Violations;
+auto resetViolations() -> void;
+
+/// Sticky floating-point exception flags, from <cfenv> and on x86 the
+/// denormal-operand flag of the MXCSR register.
+struct FloatingPointFlags
+{
+    bool invalid{false};
+    bool divideByZero{false};
+    bool overflow{false};
+    bool underflow{false};
+    bool denormalOperand{false};
+};
+
+auto clearFloatingPointFlags() -> void;
+[[nodiscard]] auto readFloatingPointFlags() -> FloatingPointFlags;
+
+}  // namespace realtime
@@ -0,0 +1,205 @@
+#include "realtime_guard.hpp"
+#include "registry.hpp"
+#include "stimulus.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr auto BlockSize = std::size_t{32};
+constexpr auto NumBlocks = std::size_t{2048};
+
+/// Per block, the number of blocks in which each condition occurred.
+struct FloatingPointReport
+{
+    std::size_t subnormalOutputs{0};
+    std::size_t nanOutputs{0};
+    std::size_t infOutputs{0};
+    std::size_t invalid{0};
+    std::size_t divideByZero{0};
+    std::size_t overflow{0};
+    std::size_t underflow{0};
+    std::size_t denormalOperand{0};
+};
+
+/// Counts the classes of the output samples & the FP exceptions raised while
+/// processing a block.
+auto accumulate(FloatingPointReport& report, std::vector<float> const& buffer, realtime::FloatingPointFlags flags)
+    -> void
+{
+    auto subnormal = false;
+    auto nan       = false;
+    auto inf       = false;
+    for (auto const sample : buffer) {
+        auto const category = std::fpclassify(sample);
+        subnormal           = subnormal or category == FP_SUBNORMAL;
+        nan                 = nan or category == FP_NAN;
+        inf                 = inf or category == FP_INFINITE;
+    }
+
+    report.subnormalOutputs += std::size_t(subnormal);
+    report.nanOutputs += std::size_t(nan);
+    report.infOutputs += std::size_t(inf);
+    report.invalid += std::size_t(flags.invalid);
+    report.divideByZero += std::size_t(flags.divideByZero);
+    report.overflow += std::size_t(flags.overflow);
+    report.underflow += std::size_t(flags.underflow);
+    report.denormalOperand += std::size_t(flags.denormalOperand);
+}
+
+template<typename Benchmark>
+auto run(float sampleRate, Stimulus const& stimulus) -> FloatingPointReport
+{
+    auto const length = NumBlocks * BlockSize;
+
+    auto bench    = Benchmark{sampleRate, BlockSize};
+    auto buffer   = std::vector<float>(BlockSize * 2U);
+    auto block    = grit::StereoBlock<float>{buffer.data(), BlockSize};
+    auto signal   = StimulusRng{14342};
+    auto controls = StimulusRng{4821};
+    auto report   = FloatingPointReport{};
+
+    for (auto b = std::size_t{0}; b < NumBlocks; ++b) {
+        for (auto i = std::size_t{0}; i < BlockSize; ++i) {
+            auto const index = b * BlockSize + i;
+            block(0, i)      = stimulus.sample(signal, index, length);
+            block(1, i)      = stimulus.sample(signal, index, length);
+        }
+
+        randomizeControls(controls, bench.controls());
+        pressRandomButtons(controls, bench.module());
+
+        realtime::clearFloatingPointFlags();
+        {
+            auto const scope = realtime::RealtimeScope{};
+            bench(block);
+        }
+        accumulate(report, buffer, realtime::readFloatingPointFlags());
+    }
+
+    return report;
+}
+
+template<typename Module>
+auto checkModule(char const* name) -> void
+{
+    std::printf(
+        "%-8s %-18s %6s %9s %6s %6s %8s %6s %9s %9s\n",
+        "module",
+        "stimulus",
+        "rate",
+        "subnormal",
+        "nan",
+        "inf",
+        "invalid",
+        "div0",
+        "overflow",
+        "underflow"
+    );
+
+    for (auto const sampleRate : {48'000.0F, 96'000.0F}) {
+        for (auto const& stimulus : adversarialStimuli) {
+            realtime::resetViolations();
+            auto const report     = run<EurorackModule<Module>>(sampleRate, stimulus);
+            auto const violations = realtime::violations();
+
+            std::printf(
+                "%-8s %-18s %6d %9zu %6zu %6zu %8zu %6zu %9zu %9zu (%zu with denormal operands)\n",
+                name,
+                stimulus.name,
+                int(sampleRate),
+                report.subnormalOutputs,
+                report.nanOutputs,
+                report.infOutputs,
+                report.invalid,
+                report.divideByZero,
+                report.overflow,
+                report.underflow,
+                report.denormalOperand
+            );
+
+            INFO(name << " @ " << sampleRate << " Hz with " << stimulus.name);
+            INFO("first violation: " << (violations.first != nullptr ? violations.first : "none"));
+            CHECK(violations.count == 0);
+            CHECK(report.nanOutputs == 0);
+            CHECK(report.infOutputs == 0);
+            CHECK(report.invalid == 0);
+            CHECK(report.divideByZero == 0);
+        }
+    }
+
+    std::printf("\n");
+}
+
+}  // namespace
+
+TEST_CASE("realtime: guard detects allocations & locks")
+{
+    auto mutex = std::mutex{};
+
+    realtime::resetViolations();
+    {
+        auto const scope = realtime::RealtimeScope{};
+        auto const value = std::make_unique<int>(42);
+        REQUIRE(*value == 42);
+    }
+    REQUIRE(realtime::violations().count == 2);
+    REQUIRE(std::string_view{realtime::violations().first} == "operator new");
+
+    realtime::resetViolations();
+    {
+        auto const scope = realtime::RealtimeScope{};
+        auto const lock  = std::scoped_lock{mutex};
+    }
+    REQUIRE(realtime::violations().count == 2);
+    REQUIRE(std::string_view{realtime::violations().first} == "pthread_mutex_lock");
+
+    realtime::resetViolations();
+    {
+        auto const scope   = realtime::RealtimeScope{};
+        auto* volatile ptr = std::malloc(16);  // NOLINT
+        std::free(ptr);                        // NOLINT
+    }
+    REQUIRE(realtime::violations().count == 2);
+    REQUIRE(std::string_view{realtime::violations().first} == "malloc");
+
+    // Outside of a scope nothing is recorded
+    realtime::resetViolations();
+    auto const value = std::make_unique<int>(42);
+    auto const lock  = std::scoped_lock{mutex};
+    REQUIRE(realtime::violations().count == 0);
+}
+
+TEST_CASE("realtime: guard reads floating-point exceptions")
+{
+    auto volatile zero = 0.0F;
+    auto volatile tiny = std::numeric_limits<float>::min();
+
+    realtime::clearFloatingPointFlags();
+    REQUIRE_FALSE(realtime::readFloatingPointFlags().invalid);
+    auto volatile nan = zero / zero;
+    REQUIRE(std::isnan(nan));
+    REQUIRE(realtime::readFloatingPointFlags().invalid);
+
+    realtime::clearFloatingPointFlags();
+    auto volatile subnormal = tiny / 3.0F;
+    REQUIRE(std::fpclassify(subnormal) == FP_SUBNORMAL);
+    REQUIRE(realtime::readFloatingPointFlags().underflow);
+    REQUIRE_FALSE(realtime::readFloatingPointFlags().invalid);
+}
+
+TEST_CASE("realtime: eurorack modules")
+{
+    checkModule<grit::Ares>("Ares");
+    checkModule<grit::Kyma>("Kyma");
+    checkModule<grit::Poseidon>("Poseidon");
+}
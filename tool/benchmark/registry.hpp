@@ -0,0 +1,420 @@
+#pragma once
+
+#include <grit/audio.hpp>
+#include <grit/eurorack.hpp>
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/concepts.hpp>
+#include <etl/span.hpp>
+#include <etl/type_traits.hpp>
+#include <etl/utility.hpp>
+
+// Compile-time registry of every processor in grit/audio and every module in
+// grit/eurorack. Each entry wraps the processor in an adapter with a common
+// shape: constructed from (sampleRate, blockSize) and called with a stereo
+// block. The wrapped type is exposed as ProcessorType. The suite sweeps every
+// entry over all block sizes & sample rates.
+
+template<typename... Entries>
+struct TypeList
+{
+    static constexpr auto size() -> etl::size_t { return sizeof...(Entries); }
+};
+
+template<etl::size_t N>
+struct BenchmarkName
+{
+    constexpr BenchmarkName(char const (&str)[N]) { etl::copy(str, str + N, data.begin()); }  // NOLINT
+
+    etl::array<char, N> data{};
+};
+
+template<BenchmarkName Name, typename Benchmark>
+struct RegistryEntry
+{
+    using BenchmarkType = Benchmark;
+
+    static constexpr auto name() -> char const* { return Name.data.data(); }
+};
+
+template<typename... Entries, typename Func>
+auto forEachEntry(TypeList<Entries...> /*registry*/, Func func) -> void
+{
+    (func.template operator()<Entries>(), ...);
+}
+
+inline constexpr auto benchmarkBlockSizes  = etl::array<int, 9>{1, 2, 4, 8, 16, 32, 64, 128, 256};
+inline constexpr auto benchmarkSampleRates = etl::array<float, 6>{
+    44'100.0F,
+    48'000.0F,
+    88'200.0F,
+    96'000.0F,
+    176'400.0F,
+    192'000.0F,
+};
+
+template<typename Processor>
+[[nodiscard]] auto makeProcessor() -> Processor
+{
+    if constexpr (etl::is_default_constructible_v<Processor>) {
+        return Processor{};
+    } else {
+        return Processor{typename Processor::SeedType{42}};
+    }
+}
+
+/// Applies the sample rate and a non-trivial setting, so that no processor is
+/// benchmarked in bypass.
+template<typename Processor>
+auto prepareProcessor(Processor& processor, float sampleRate) -> void
+{
+    if constexpr (requires { processor.setSampleRate(sampleRate); }) {
+        processor.setSampleRate(sampleRate);
+    }
+    if constexpr (requires { processor.setFrequency(440.0F); }) {
+        processor.setFrequency(440.0F);
+    }
+    if constexpr (requires { processor.setCoefficients(grit::BiquadCoefficients<float>::makeBypass()); }) {
+        processor.setCoefficients(grit::BiquadCoefficients<float>::makeLowPass(1'000.0F, 0.71F, sampleRate));
+    }
+    if constexpr (requires { processor.gate(true); }) {
+        processor.setParameter({
+            .attack  = grit::Milliseconds<float>{10.0F},
+            .decay   = grit::Milliseconds<float>{50.0F},
+            .sustain = 0.5F,
+            .release = grit::Milliseconds<float>{100.0F},
+        });
+        processor.gate(true);
+    }
+}
+
+/// Sample-by-sample effect, one instance per channel.
+template<typename Processor>
+struct StereoEffect
+{
+    using ProcessorType = Processor;
+
+    StereoEffect(float sampleRate, etl::size_t /*blockSize*/)
+    {
+        prepareProcessor(_left, sampleRate);
+        prepareProcessor(_right, sampleRate);
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            block(0, i) = _left(block(0, i));
+            block(1, i) = _right(block(1, i));
+        }
+    }
+
+private:
+    Processor _left{makeProcessor<Processor>()};
+    Processor _right{makeProcessor<Processor>()};
+};
+
+/// Source without input, one instance per channel.
+template<typename Processor>
+struct StereoGenerator
+{
+    using ProcessorType = Processor;
+
+    StereoGenerator(float sampleRate, etl::size_t /*blockSize*/)
+    {
+        prepareProcessor(_left, sampleRate);
+        prepareProcessor(_right, sampleRate);
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            block(0, i) = _left();
+            block(1, i) = _right();
+        }
+    }
+
+private:
+    Processor _left{makeProcessor<Processor>()};
+    Processor _right{makeProcessor<Processor>()};
+};
+
+/// Mono sample-by-sample effect. The interleaved stereo block is processed as
+/// one contiguous stream of 2 * blockSize samples, the baseline for MonoBlockEffect.
+template<typename Processor>
+struct MonoEffect
+{
+    using ProcessorType = Processor;
+
+    MonoEffect(float sampleRate, etl::size_t /*blockSize*/) { prepareProcessor(_processor, sampleRate); }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto& x : etl::span{block.data_handle(), block.size()}) {
+            x = _processor(x);
+        }
+    }
+
+private:
+    Processor _processor{makeProcessor<Processor>()};
+};
+
+/// Mono block processing with process(span), on the same stream as MonoEffect.
+/// Neither adapter copies, the difference in time between both is the gain of
+/// the block path. It keeps coefficients & state in registers, the per-sample
+/// path reloads them after every output store. On x86-64 the reloads fold into
+/// memory operands, so both retire about the same number of instructions.
+template<typename Processor>
+struct MonoBlockEffect
+{
+    using ProcessorType = Processor;
+
+    MonoBlockEffect(float sampleRate, etl::size_t /*blockSize*/) { prepareProcessor(_processor, sampleRate); }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        _processor.process(etl::span{block.data_handle(), block.size()});
+    }
+
+private:
+    Processor _processor{makeProcessor<Processor>()};
+};
+
+/// Block source without input, one instance per channel. Blocks larger than
+/// the biggest benchmark block size are generated in chunks.
+template<typename Processor>
+struct StereoBlockGenerator
+{
+    using ProcessorType = Processor;
+
+    StereoBlockGenerator(float sampleRate, etl::size_t /*blockSize*/)
+    {
+        prepareProcessor(_left, sampleRate);
+        prepareProcessor(_right, sampleRate);
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto offset = etl::size_t(0); offset < block.extent(1); offset += _leftBuffer.size()) {
+            auto const size = etl::min(block.extent(1) - offset, _leftBuffer.size());
+            _left.process(etl::span{_leftBuffer.data(), size});
+            _right.process(etl::span{_rightBuffer.data(), size});
+
+            for (auto i{0U}; i < size; ++i) {
+                block(0, offset + i) = _leftBuffer[i];
+                block(1, offset + i) = _rightBuffer[i];
+            }
+        }
+    }
+
+private:
+    Processor _left{makeProcessor<Processor>()};
+    Processor _right{makeProcessor<Processor>()};
+    etl::array<float, benchmarkBlockSizes.back()> _leftBuffer{};
+    etl::array<float, benchmarkBlockSizes.back()> _rightBuffer{};
+};
+
+/// Delay line with a fractional delay of 10ms, one instance per channel.
+template<typename DelayLine>
+struct StereoDelay
+{
+    using ProcessorType = DelayLine;
+
+    StereoDelay(float sampleRate, etl::size_t /*blockSize*/)
+    {
+        _left.setDelay(sampleRate * 0.01F + 0.5F);
+        _right.setDelay(sampleRate * 0.01F + 0.5F);
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            _left.pushSample(block(0, i));
+            _right.pushSample(block(1, i));
+            block(0, i) = _left.popSample();
+            block(1, i) = _right.popSample();
+        }
+    }
+
+private:
+    DelayLine _left{};
+    DelayLine _right{};
+};
+
+/// Processor of a whole stereo frame.
+template<typename Processor>
+struct StereoFrameEffect
+{
+    using ProcessorType = Processor;
+
+    StereoFrameEffect(float /*sampleRate*/, etl::size_t /*blockSize*/) {}
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            auto const out = _processor(grit::StereoFrame<float>{block(0, i), block(1, i)});
+            block(0, i)    = out.left;
+            block(1, i)    = out.right;
+        }
+    }
+
+private:
+    Processor _processor{1.5F};
+};
+
+/// Cross fade between both channels, swapped for the right output.
+struct StereoCrossFade
+{
+    using ProcessorType = grit::CrossFade<float>;
+
+    StereoCrossFade(float /*sampleRate*/, etl::size_t /*blockSize*/)
+    {
+        _fade.setParameter({.mix = 0.25F, .curve = grit::CrossFadeCurve::ConstantPower});
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        for (auto i{0U}; i < block.extent(1); ++i) {
+            auto const left  = block(0, i);
+            auto const right = block(1, i);
+            block(0, i)      = _fade(left, right);
+            block(1, i)      = _fade(right, left);
+        }
+    }
+
+private:
+    grit::CrossFade<float> _fade{};
+};
+
+/// Eurorack firmware module with default controls & an open gate.
+template<typename Module>
+struct EurorackModule
+{
+    using ProcessorType = Module;
+
+    EurorackModule(float sampleRate, etl::size_t blockSize)
+    {
+        _module.prepare(sampleRate, blockSize);
+        if constexpr (requires { _inputs.gate; }) {
+            _inputs.gate = true;
+        }
+        if constexpr (requires { _inputs.gate1; }) {
+            _inputs.gate1 = true;
+        }
+    }
+
+    auto operator()(grit::StereoBlock<float> const& block) -> void
+    {
+        static_cast<void>(_module.process(block, _inputs));
+    }
+
+    [[nodiscard]] auto module() -> Module& { return _module; }
+    [[nodiscard]] auto controls() -> typename Module::ControlInput& { return _inputs; }
+
+private:
+    Module _module{};
+    typename Module::ControlInput _inputs{};
+};
+
+struct SineWavetableOscillator : grit::WavetableOscillator<float, 2048>
+{
+    SineWavetableOscillator() : WavetableOscillator{etl::mdspan{sine.data(), etl::extents<etl::size_t, 2048>{}}} {}
+
+private:
+    static constexpr auto sine = grit::makeSineWavetable<float, 2048>();
+};
+
+/// Lowpass into a clipper, the biquad is configured like the standalone entry.
+struct BiquadClipperChain : grit::Chain<grit::Biquad<float>, grit::HardClipperADAA1<float>>
+{
+    auto setSampleRate(float sampleRate) -> void
+    {
+        Chain::setSampleRate(sampleRate);
+        get<0>().setCoefficients(grit::BiquadCoefficients<float>::makeLowPass(1'000.0F, 0.71F, sampleRate));
+    }
+};
+
+using ProcessorRegistry = TypeList<
+    RegistryEntry<"AirWindowsFireAmp", StereoEffect<grit::AirWindowsFireAmp<float>>>,
+    RegistryEntry<"AirWindowsGrindAmp", StereoEffect<grit::AirWindowsGrindAmp<float>>>,
+    RegistryEntry<"AirWindowsVinylDither", StereoEffect<grit::AirWindowsVinylDither<float>>>,
+    RegistryEntry<"StaticDelayLine", StereoDelay<grit::StaticDelayLine<float, 2048>>>,
+    RegistryEntry<"HardKneeCompressor", StereoEffect<grit::HardKneeCompressor<float>>>,
+    RegistryEntry<"SoftKneeCompressor", StereoEffect<grit::SoftKneeCompressor<float>>>,
+    RegistryEntry<"SoftKneeCompressor (mono)", MonoEffect<grit::SoftKneeCompressor<float>>>,
+    RegistryEntry<"SoftKneeCompressor (mono block)", MonoBlockEffect<grit::SoftKneeCompressor<float>>>,
+    RegistryEntry<"TransientShaper", StereoEffect<grit::TransientShaper<float>>>,
+    RegistryEntry<"EnvelopeADSR", StereoGenerator<grit::EnvelopeADSR<float>>>,
+    RegistryEntry<"EnvelopeFollower", StereoEffect<grit::EnvelopeFollower<float>>>,
+    RegistryEntry<"EnvelopeFollower (mono)", MonoEffect<grit::EnvelopeFollower<float>>>,
+    RegistryEntry<"EnvelopeFollower (mono block)", MonoBlockEffect<grit::EnvelopeFollower<float>>>,
+    RegistryEntry<"Biquad", StereoEffect<grit::Biquad<float>>>,
+    RegistryEntry<"Biquad (mono)", MonoEffect<grit::Biquad<float>>>,
+    RegistryEntry<"Biquad (mono block)", MonoBlockEffect<grit::Biquad<float>>>,
+    RegistryEntry<"DynamicSmoothing", StereoEffect<grit::DynamicSmoothing<float>>>,
+    RegistryEntry<"DynamicSmoothing (mono)", MonoEffect<grit::DynamicSmoothing<float>>>,
+    RegistryEntry<"DynamicSmoothing (mono block)", MonoBlockEffect<grit::DynamicSmoothing<float>>>,
+    RegistryEntry<"StateVariableLowpass", StereoEffect<grit::StateVariableLowpass<float>>>,
+    RegistryEntry<"StateVariableLowpass (mono)", MonoEffect<grit::StateVariableLowpass<float>>>,
+    RegistryEntry<"StateVariableLowpass (mono block)", MonoBlockEffect<grit::StateVariableLowpass<float>>>,
+    RegistryEntry<"CrossFade", StereoCrossFade>,
+    RegistryEntry<"TriangleDither", StereoEffect<grit::TriangleDither<etl::xoshiro128plusplus>>>,
+    RegistryEntry<"WhiteNoise", StereoGenerator<grit::WhiteNoise<float>>>,
+    RegistryEntry<"Oscillator", StereoGenerator<grit::Oscillator<float>>>,
+    RegistryEntry<"Oscillator (block)", StereoBlockGenerator<grit::Oscillator<float>>>,
+    RegistryEntry<"VariableShapeOscillator", StereoGenerator<grit::VariableShapeOscillator<float>>>,
+    RegistryEntry<"VariableShapeOscillator (block)", StereoBlockGenerator<grit::VariableShapeOscillator<float>>>,
+    RegistryEntry<"WavetableOscillator", StereoGenerator<SineWavetableOscillator>>,
+    RegistryEntry<"WavetableOscillator (block)", StereoBlockGenerator<SineWavetableOscillator>>,
+    RegistryEntry<"StereoWidth", StereoFrameEffect<grit::StereoWidth<float>>>,
+    RegistryEntry<"DiodeRectifier", StereoEffect<grit::DiodeRectifier<float>>>,
+    RegistryEntry<"DiodeRectifierADAA1", StereoEffect<grit::DiodeRectifierADAA1<float>>>,
+    RegistryEntry<"FullWaveRectifier", StereoEffect<grit::FullWaveRectifier<float>>>,
+    RegistryEntry<"FullWaveRectifierADAA1", StereoEffect<grit::FullWaveRectifierADAA1<float>>>,
+    RegistryEntry<"HalfWaveRectifier", StereoEffect<grit::HalfWaveRectifier<float>>>,
+    RegistryEntry<"HalfWaveRectifierADAA1", StereoEffect<grit::HalfWaveRectifierADAA1<float>>>,
+    RegistryEntry<"HardClipper", StereoEffect<grit::HardClipper<float>>>,
+    RegistryEntry<"HardClipperADAA1", StereoEffect<grit::HardClipperADAA1<float>>>,
+    RegistryEntry<"HardClipperADAA1 (mono)", MonoEffect<grit::HardClipperADAA1<float>>>,
+    RegistryEntry<"HardClipperADAA1 (mono block)", MonoBlockEffect<grit::HardClipperADAA1<float>>>,
+    RegistryEntry<"TanhClipper", StereoEffect<grit::TanhClipper<float>>>,
+    RegistryEntry<"TanhClipper (mono)", MonoEffect<grit::TanhClipper<float>>>,
+    RegistryEntry<"TanhClipper (mono block)", MonoBlockEffect<grit::TanhClipper<float>>>,
+    RegistryEntry<"TanhClipperADAA1", StereoEffect<grit::TanhClipperADAA1<float>>>,
+    RegistryEntry<"TanhClipperADAA1 (mono)", MonoEffect<grit::TanhClipperADAA1<float>>>,
+    RegistryEntry<"TanhClipperADAA1 (mono block)", MonoBlockEffect<grit::TanhClipperADAA1<float>>>,
+    RegistryEntry<"BiquadClipperChain", StereoEffect<BiquadClipperChain>>,
+    RegistryEntry<"BiquadClipperChain (mono)", MonoEffect<BiquadClipperChain>>,
+    RegistryEntry<"BiquadClipperChain (mono block)", MonoBlockEffect<BiquadClipperChain>>,
+    RegistryEntry<"Ares", EurorackModule<grit::Ares>>,
+    RegistryEntry<"Kyma", EurorackModule<grit::Kyma>>,
+    RegistryEntry<"Poseidon", EurorackModule<grit::Poseidon>>>;
+
+/// Cost of one block split into a constant per-call overhead and a per-sample
+/// cost. Least-squares fit of t(blockSize) = perBlock + perSample * blockSize.
+struct BlockCost
+{
+    double perBlock{0.0};
+    double perSample{0.0};
+};
+
+template<etl::size_t N>
+[[nodiscard]] auto fitBlockCost(etl::array<int, N> const& blockSizes, etl::array<double, N> const& times)
+    -> BlockCost
+{
+    auto sx  = 0.0;
+    auto sy  = 0.0;
+    auto sxx = 0.0;
+    auto sxy = 0.0;
+    for (auto i{0U}; i < N; ++i) {
+        auto const x = double(blockSizes[i]);
+        sx += x;
+        sy += times[i];
+        sxx += x * x;
+        sxy += x * times[i];
+    }
+
+    auto const n         = double(N);
+    auto const perSample = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    return BlockCost{.perBlock = (sy - perSample * sx) / n, .perSample = perSample};
+}
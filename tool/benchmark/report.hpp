@@ -0,0 +1,162 @@
+#pragma once
+
+#include <etl/algorithm.hpp>
+#include <etl/array.hpp>
+#include <etl/iterator.hpp>
+#include <etl/string_view.hpp>
+
+#include <stdio.h>  // NOLINT(modernize-deprecated-headers)
+
+// Machine readable benchmark results, shared by the daisy & host executables.
+// Numbers are formatted with integer arithmetic, the daisy firmware links
+// newlib-nano without floating point printf support.
+
+enum struct ReportFormat
+{
+    Text,
+    Csv,
+    Json,
+};
+
+/// All durations are per call of the benchmark in nanoseconds. Size is the
+/// block size for audio and the transform size for fft benchmarks.
+struct BenchmarkResult
+{
+    char const* kind{""};
+    char const* name{""};
+    int size{0};
+    int sampleRate{0};
+    double min{0.0};
+    double median{0.0};
+    double p99{0.0};
+    double max{0.0};
+    double cyclesPerSample{0.0};
+};
+
+/// Strips the padding & separators used for the aligned text output.
+[[nodiscard]] inline auto trimBenchmarkName(char const* name) -> etl::string_view
+{
+    auto trimmed = etl::string_view{name};
+    while (not trimmed.empty() and (trimmed.back() == ' ' or trimmed.back() == ':' or trimmed.back() == '-')) {
+        trimmed.remove_suffix(1);
+    }
+    return trimmed;
+}
+
+/// Value with 3 decimal places, printed with "%s%ld.%03ld".
+struct FixedPoint
+{
+    explicit FixedPoint(double value)
+        : sign{value < 0.0 ? "-" : ""}
+        , whole{static_cast<long>((value < 0.0 ? -value : value) * 1000.0 + 0.5) / 1000}
+        , frac{static_cast<long>((value < 0.0 ? -value : value) * 1000.0 + 0.5) % 1000}
+    {}
+
+    char const* sign;
+    long whole;
+    long frac;
+};
+
+struct BenchmarkReporter
+{
+    using PrintLine = void (*)(char const* line);
+
+    BenchmarkReporter(ReportFormat format, PrintLine print) : _format{format}, _print{print} {}
+
+    [[nodiscard]] auto format() const -> ReportFormat { return _format; }
+
+    auto begin() -> void
+    {
+        if (_format == ReportFormat::Csv) {
+            _print("kind,name,size,sample_rate,min_ns,median_ns,p99_ns,max_ns,cycles_per_sample");
+        } else if (_format == ReportFormat::Json) {
+            _print("[");
+        }
+    }
+
+    auto add(BenchmarkResult const& result) -> void
+    {
+        if (_format == ReportFormat::Csv) {
+            formatRecord(result, "%s,\"%.*s\",%d,%d,%s%ld.%03ld,%s%ld.%03ld,%s%ld.%03ld,%s%ld.%03ld,%s%ld.%03ld", "");
+            _print(_line.data());
+        } else if (_format == ReportFormat::Json) {
+            // The separating comma is only known once the next record arrives.
+            if (_hasPending) {
+                _print(_line.data());
+            }
+            formatRecord(
+                result,
+                R"(  {"kind": "%s", "name": "%.*s", "size": %d, "sample_rate": %d, "min_ns": %s%ld.%03ld, )"
+                R"("median_ns": %s%ld.%03ld, "p99_ns": %s%ld.%03ld, "max_ns": %s%ld.%03ld, )"
+                R"("cycles_per_sample": %s%ld.%03ld}%s)",
+                ","
+            );
+            _hasPending = true;
+        }
+    }
+
+    auto end() -> void
+    {
+        if (_format == ReportFormat::Json) {
+            if (_hasPending) {
+                auto const last = etl::find(_line.begin(), _line.end(), '\0');
+                *etl::prev(last) = '\0';
+                _print(_line.data());
+                _hasPending = false;
+            }
+            _print("]");
+        }
+    }
+
+private:
+    auto formatRecord(BenchmarkResult const& result, char const* fmt, char const* suffix) -> void
+    {
+        auto const name      = trimBenchmarkName(result.name);
+        auto const min       = FixedPoint{result.min};
+        auto const median    = FixedPoint{result.median};
+        auto const p99       = FixedPoint{result.p99};
+        auto const max       = FixedPoint{result.max};
+        auto const perSample = FixedPoint{result.cyclesPerSample};
+
+        snprintf(  // NOLINT
+            _line.data(),
+            _line.size(),
+            fmt,
+            result.kind,
+            static_cast<int>(name.size()),
+            name.data(),
+            result.size,
+            result.sampleRate,
+            min.sign,
+            min.whole,
+            min.frac,
+            median.sign,
+            median.whole,
+            median.frac,
+            p99.sign,
+            p99.whole,
+            p99.frac,
+            max.sign,
+            max.whole,
+            max.frac,
+            perSample.sign,
+            perSample.whole,
+            perSample.frac,
+            suffix
+        );
+    }
+
+    ReportFormat _format;
+    PrintLine _print;
+    etl::array<char, 384> _line{};
+    bool _hasPending{false};
+};
+
+/// Value at the given quantile of [first, last). Sorts the range.
+template<typename It>
+[[nodiscard]] auto quantile(It first, It last, double q)
+{
+    auto const count = static_cast<double>(etl::distance(first, last) - 1);
+    etl::sort(first, last);
+    return *(first + static_cast<long>(q * count + 0.5));
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <grit/eurorack.hpp>
+
+#include <etl/array.hpp>
+#include <etl/cmath.hpp>
+#include <etl/limits.hpp>
+#include <etl/random.hpp>
+
+// Adversarial test signals for the worst-case execution time harness. Each
+// stimulus is a pure function of the sample index, the run length and the rng.
+// Reseeding the rng repeats a run bit-identically. None of them produce NaN or
+// inf, but several drive the feedback paths of filters & envelopes into
+// subnormal numbers or the nonlinearities far beyond full scale.
+
+using StimulusRng = etl::xoshiro128plusplus;
+
+struct Stimulus
+{
+    using Generator = float (*)(StimulusRng& rng, etl::size_t index, etl::size_t length);
+
+    char const* name;
+    Generator sample;
+};
+
+namespace stimulus {
+
+[[nodiscard]] inline auto uniform(StimulusRng& rng, float amplitude) -> float
+{
+    auto dist = etl::uniform_real_distribution<float>{-amplitude, amplitude};
+    return dist(rng);
+}
+
+[[nodiscard]] inline auto randomSign(StimulusRng& rng) -> float { return (rng() & 1U) != 0 ? 1.0F : -1.0F; }
+
+/// Reference, the same signal as audioBench.
+[[nodiscard]] inline auto noise(StimulusRng& rng, etl::size_t /*index*/, etl::size_t /*length*/) -> float
+{
+    return uniform(rng, 1.0F);
+}
+
+[[nodiscard]] inline auto silence(StimulusRng& /*rng*/, etl::size_t /*index*/, etl::size_t /*length*/) -> float
+{
+    return 0.0F;
+}
+
+/// Full scale noise for the first quarter, then silence. The feedback paths
+/// of filters & envelope followers decay into subnormals.
+[[nodiscard]] inline auto loudThenSilence(StimulusRng& rng, etl::size_t index, etl::size_t length) -> float
+{
+    return index < length / 4 ? uniform(rng, 1.0F) : 0.0F;
+}
+
+/// Noise with an exponentially decaying amplitude. Passes through the whole
+/// subnormal range between ~80% and ~95% of the first half of the run.
+[[nodiscard]] inline auto denormalDecay(StimulusRng& rng, etl::size_t index, etl::size_t length) -> float
+{
+    auto const decay = 110.0F / static_cast<float>(length / 2 + 1);
+    return uniform(rng, 1.0F) * etl::exp(-decay * static_cast<float>(index));
+}
+
+/// Constant subnormal input, every operation in a linear filter stays subnormal.
+[[nodiscard]] inline auto subnormalDc(StimulusRng& /*rng*/, etl::size_t /*index*/, etl::size_t /*length*/) -> float
+{
+    return etl::numeric_limits<float>::denorm_min() * 1024.0F;
+}
+
+[[nodiscard]] inline auto dc(StimulusRng& /*rng*/, etl::size_t /*index*/, etl::size_t /*length*/) -> float
+{
+    return 1.0F;
+}
+
+/// Full scale impulse every 4096 samples, each followed by a long ring-down.
+[[nodiscard]] inline auto impulses(StimulusRng& /*rng*/, etl::size_t index, etl::size_t /*length*/) -> float
+{
+    return index % 4096U == 0 ? 1.0F : 0.0F;
+}
+
+/// ±1 at nyquist, worst case for slew dependent & ADAA code paths.
+[[nodiscard]] inline auto squareNyquist(StimulusRng& /*rng*/, etl::size_t index, etl::size_t /*length*/) -> float
+{
+    return index % 2U == 0 ? 1.0F : -1.0F;
+}
+
+/// ±1 with a period of 200 samples.
+[[nodiscard]] inline auto squareLow(StimulusRng& /*rng*/, etl::size_t index, etl::size_t /*length*/) -> float
+{
+    return index % 200U < 100U ? 1.0F : -1.0F;
+}
+
+/// Random signs at 18dB above full scale.
+[[nodiscard]] inline auto overdrive(StimulusRng& rng, etl::size_t /*index*/, etl::size_t /*length*/) -> float
+{
+    return randomSign(rng) * 8.0F;
+}
+
+/// Random signs at the smallest normal float.
+[[nodiscard]] inline auto tiny(StimulusRng& rng, etl::size_t /*index*/, etl::size_t /*length*/) -> float
+{
+    return randomSign(rng) * etl::numeric_limits<float>::min();
+}
+
+}  // namespace stimulus
+
+inline constexpr auto adversarialStimuli = etl::array<Stimulus, 11>{
+    Stimulus{"noise", stimulus::noise},
+    Stimulus{"silence", stimulus::silence},
+    Stimulus{"loud-then-silence", stimulus::loudThenSilence},
+    Stimulus{"denormal-decay", stimulus::denormalDecay},
+    Stimulus{"subnormal-dc", stimulus::subnormalDc},
+    Stimulus{"dc", stimulus::dc},
+    Stimulus{"impulses", stimulus::impulses},
+    Stimulus{"square-nyquist", stimulus::squareNyquist},
+    Stimulus{"square-low", stimulus::squareLow},
+    Stimulus{"overdrive", stimulus::overdrive},
+    Stimulus{"tiny", stimulus::tiny},
+};
+
+// Random control jumps & button presses, applied once per block. Knobs are
+// unipolar, CV inputs bipolar, like the values returned by GetAdcValue.
+
+template<typename Module>
+auto pressRandomButtons(StimulusRng& /*rng*/, Module& /*module*/) -> void
+{}
+
+inline auto pressRandomButtons(StimulusRng& rng, grit::Poseidon& module) -> void
+{
+    if (rng() % 16U == 0) {
+        module.nextDistortionAlgorithm();
+    }
+}
+
+inline auto randomizeControls(StimulusRng& rng, grit::Ares::ControlInput& inputs) -> void
+{
+    auto knob = etl::uniform_real_distribution<float>{0.0F, 1.0F};
+    auto cv   = etl::uniform_real_distribution<float>{-1.0F, 1.0F};
+
+    inputs.mode       = (rng() & 1U) != 0 ? grit::Ares::Mode::Fire : grit::Ares::Mode::Grind;
+    inputs.gainKnob   = knob(rng);
+    inputs.toneKnob   = knob(rng);
+    inputs.outputKnob = knob(rng);
+    inputs.mixKnob    = knob(rng);
+    inputs.gainCV     = cv(rng);
+    inputs.toneCV     = cv(rng);
+    inputs.outputCV   = cv(rng);
+    inputs.mixCV      = cv(rng);
+}
+
+inline auto randomizeControls(StimulusRng& rng, grit::Kyma::ControlInput& inputs) -> void
+{
+    auto knob = etl::uniform_real_distribution<float>{0.0F, 1.0F};
+    auto cv   = etl::uniform_real_distribution<float>{-1.0F, 1.0F};
+
+    inputs.pitchKnob   = knob(rng);
+    inputs.morphKnob   = knob(rng);
+    inputs.attackKnob  = knob(rng);
+    inputs.releaseKnob = knob(rng);
+    inputs.vOctCV      = cv(rng);
+    inputs.morphCV     = cv(rng);
+    inputs.subGainCV   = cv(rng);
+    inputs.subMorphCV  = cv(rng);
+    inputs.gate        = (rng() & 1U) != 0;
+    inputs.subShift    = (rng() & 1U) != 0;
+}
+
+inline auto randomizeControls(StimulusRng& rng, grit::Poseidon::ControlInput& inputs) -> void
+{
+    auto knob = etl::uniform_real_distribution<float>{0.0F, 1.0F};
+    auto cv   = etl::uniform_real_distribution<float>{-1.0F, 1.0F};
+
+    inputs.textureKnob    = knob(rng);
+    inputs.morphKnob      = knob(rng);
+    inputs.ampKnob        = knob(rng);
+    inputs.compressorKnob = knob(rng);
+    inputs.morphCV        = cv(rng);
+    inputs.sideChainCV    = cv(rng);
+    inputs.attackCV       = cv(rng);
+    inputs.releaseCV      = cv(rng);
+    inputs.gate1          = (rng() & 1U) != 0;
+    inputs.gate2          = (rng() & 1U) != 0;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+// Shared by the daisy & host benchmark executables. The including file has to
+// define audioBench<BlockSize>(name, sampleRate, bench), fftBench<N>(name, bench),
+// printBlockCost(name, sampleRate, cost) and printSeparator() before including
+// this header. audioBench returns the time of one block in nanoseconds.
+
+#include "benchmarks.hpp"
+#include "registry.hpp"
+
+inline auto runAudioSuite() -> void
+{
+    using FireAmp     = StereoProcessor<grit::AirWindowsFireAmp<float>>;
+    using GrindAmp    = StereoProcessor<grit::AirWindowsGrindAmp<float>>;
+    using VinylDither = StereoProcessor<grit::AirWindowsVinylDither<float>>;
+
+    static constexpr auto sampleRate = 96'000.0F;
+
+    audioBench<16>("AirWindowsFireAmp:     ", sampleRate, FireAmp{sampleRate});
+    audioBench<16>("AirWindowsGrindAmp:    ", sampleRate, GrindAmp{sampleRate});
+    audioBench<16>("AirWindowsVinylDither: ", sampleRate, VinylDither{sampleRate});
+    printSeparator();
+
+    audioBench<32>("AirWindowsFireAmp:     ", sampleRate, FireAmp{sampleRate});
+    audioBench<32>("AirWindowsGrindAmp:    ", sampleRate, GrindAmp{sampleRate});
+    audioBench<32>("AirWindowsVinylDither: ", sampleRate, VinylDither{sampleRate});
+    printSeparator();
+
+    audioBench<64>("AirWindowsFireAmp:     ", sampleRate, FireAmp{sampleRate});
+    audioBench<64>("AirWindowsGrindAmp:    ", sampleRate, GrindAmp{sampleRate});
+    audioBench<64>("AirWindowsVinylDither: ", sampleRate, VinylDither{sampleRate});
+    printSeparator();
+}
+
+template<typename Entry, etl::size_t... I>
+auto sweepBlockSizes(float sampleRate, etl::index_sequence<I...> /*indices*/) -> void
+{
+    using Benchmark = typename Entry::BenchmarkType;
+
+    auto const times = etl::array<double, sizeof...(I)>{
+        audioBench<benchmarkBlockSizes[I]>(
+            Entry::name(),
+            sampleRate,
+            Benchmark{sampleRate, static_cast<etl::size_t>(benchmarkBlockSizes[I])}
+        )...,
+    };
+
+    printBlockCost(Entry::name(), sampleRate, fitBlockCost(benchmarkBlockSizes, times));
+}
+
+inline auto runRegistrySuite() -> void
+{
+    forEachEntry(ProcessorRegistry{}, []<typename Entry> {
+        for (auto const sampleRate : benchmarkSampleRates) {
+            sweepBlockSizes<Entry>(sampleRate, etl::make_index_sequence<benchmarkBlockSizes.size()>());
+        }
+        printSeparator();
+    });
+}
+
+inline auto runFftSuite() -> void
+{
+    fftBench<64>("ComplexRoundtrip<float, 16, v3>      - ", ComplexRoundtrip<float, 16, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 32, v3>      - ", ComplexRoundtrip<float, 32, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 64, v3>      - ", ComplexRoundtrip<float, 64, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 128, v3>     - ", ComplexRoundtrip<float, 128, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 256, v3>     - ", ComplexRoundtrip<float, 256, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 512, v3>     - ", ComplexRoundtrip<float, 512, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 1024, v3>    - ", ComplexRoundtrip<float, 1024, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 2048, v3>    - ", ComplexRoundtrip<float, 2048, c2c_dit2_v3>{});
+    fftBench<64>("ComplexRoundtrip<float, 4096, v3>    - ", ComplexRoundtrip<float, 4096, c2c_dit2_v3>{});
+    printSeparator();
+
+    fftBench<64>("StaticComplexRoundtrip<float, 64>   - ", StaticComplexRoundtrip<float, 64>{});
+    fftBench<64>("StaticComplexRoundtrip<float, 128>  - ", StaticComplexRoundtrip<float, 128>{});
+    fftBench<64>("StaticComplexRoundtrip<float, 256>  - ", StaticComplexRoundtrip<float, 256>{});
+    fftBench<64>("StaticComplexRoundtrip<float, 512>  - ", StaticComplexRoundtrip<float, 512>{});
+    fftBench<64>("StaticComplexRoundtrip<float, 1024> - ", StaticComplexRoundtrip<float, 1024>{});
+    fftBench<64>("StaticComplexRoundtrip<float, 2048> - ", StaticComplexRoundtrip<float, 2048>{});
+    fftBench<64>("StaticComplexRoundtrip<float, 4096> - ", StaticComplexRoundtrip<float, 4096>{});
+    printSeparator();
+
+    fftBench<64>("StaticStockhamRoundtrip<float, 64>   - ", StaticStockhamRoundtrip<float, 64>{});
+    fftBench<64>("StaticStockhamRoundtrip<float, 128>  - ", StaticStockhamRoundtrip<float, 128>{});
+    fftBench<64>("StaticStockhamRoundtrip<float, 256>  - ", StaticStockhamRoundtrip<float, 256>{});
+    fftBench<64>("StaticStockhamRoundtrip<float, 512>  - ", StaticStockhamRoundtrip<float, 512>{});
+    fftBench<64>("StaticStockhamRoundtrip<float, 1024> - ", StaticStockhamRoundtrip<float, 1024>{});
+    fftBench<64>("StaticStockhamRoundtrip<float, 2048> - ", StaticStockhamRoundtrip<float, 2048>{});
+    fftBench<64>("StaticStockhamRoundtrip<float, 4096> - ", StaticStockhamRoundtrip<float, 4096>{});
+    printSeparator();
+
+    fftBench<64>("StaticRadix4Roundtrip<float, 64>     - ", StaticRadix4Roundtrip<float, 64>{});
+    fftBench<64>("StaticRadix4Roundtrip<float, 128>    - ", StaticRadix4Roundtrip<float, 128>{});
+    fftBench<64>("StaticRadix4Roundtrip<float, 256>    - ", StaticRadix4Roundtrip<float, 256>{});
+    fftBench<64>("StaticRadix4Roundtrip<float, 512>    - ", StaticRadix4Roundtrip<float, 512>{});
+    fftBench<64>("StaticRadix4Roundtrip<float, 1024>   - ", StaticRadix4Roundtrip<float, 1024>{});
+    fftBench<64>("StaticRadix4Roundtrip<float, 2048>   - ", StaticRadix4Roundtrip<float, 2048>{});
+    fftBench<64>("StaticRadix4Roundtrip<float, 4096>   - ", StaticRadix4Roundtrip<float, 4096>{});
+    printSeparator();
+
+    fftBench<64>("StaticMixedRadixRoundtrip<float, 48>    - ", StaticMixedRadixRoundtrip<float, 48>{});
+    fftBench<64>("StaticMixedRadixRoundtrip<float, 96>    - ", StaticMixedRadixRoundtrip<float, 96>{});
+    fftBench<64>("StaticMixedRadixRoundtrip<float, 192>   - ", StaticMixedRadixRoundtrip<float, 192>{});
+    fftBench<64>("StaticMixedRadixRoundtrip<float, 384>   - ", StaticMixedRadixRoundtrip<float, 384>{});
+    fftBench<64>("StaticMixedRadixRoundtrip<float, 768>   - ", StaticMixedRadixRoundtrip<float, 768>{});
+    fftBench<64>("StaticMixedRadixRoundtrip<float, 1536>  - ", StaticMixedRadixRoundtrip<float, 1536>{});
+    fftBench<64>("StaticMixedRadixRoundtrip<float, 3072>  - ", StaticMixedRadixRoundtrip<float, 3072>{});
+    printSeparator();
+
+    fftBench<64>("StaticRealRoundtrip<float, 64>      - ", StaticRealRoundtrip<float, 64>{});
+    fftBench<64>("StaticRealRoundtrip<float, 128>     - ", StaticRealRoundtrip<float, 128>{});
+    fftBench<64>("StaticRealRoundtrip<float, 256>     - ", StaticRealRoundtrip<float, 256>{});
+    fftBench<64>("StaticRealRoundtrip<float, 512>     - ", StaticRealRoundtrip<float, 512>{});
+    fftBench<64>("StaticRealRoundtrip<float, 1024>    - ", StaticRealRoundtrip<float, 1024>{});
+    fftBench<64>("StaticRealRoundtrip<float, 2048>    - ", StaticRealRoundtrip<float, 2048>{});
+    fftBench<64>("StaticRealRoundtrip<float, 4096>    - ", StaticRealRoundtrip<float, 4096>{});
+    printSeparator();
+
+    fftBench<64>("StaticSplitRoundtrip<float, 64>     - ", StaticSplitRoundtrip<float, 64>{});
+    fftBench<64>("StaticSplitRoundtrip<float, 128>    - ", StaticSplitRoundtrip<float, 128>{});
+    fftBench<64>("StaticSplitRoundtrip<float, 256>    - ", StaticSplitRoundtrip<float, 256>{});
+    fftBench<64>("StaticSplitRoundtrip<float, 512>    - ", StaticSplitRoundtrip<float, 512>{});
+    fftBench<64>("StaticSplitRoundtrip<float, 1024>   - ", StaticSplitRoundtrip<float, 1024>{});
+    fftBench<64>("StaticSplitRoundtrip<float, 2048>   - ", StaticSplitRoundtrip<float, 2048>{});
+    fftBench<64>("StaticSplitRoundtrip<float, 4096>   - ", StaticSplitRoundtrip<float, 4096>{});
+    printSeparator();
+
+    fftBench<64>("StaticComplexHop<1024, 256>         - ", StaticComplexHop<1024, 256>{});
+    fftBench<64>("SlidingDftHop<1024, 1, 256>         - ", SlidingDftHop<1024, 1, 256>{});
+    fftBench<64>("SlidingDftHop<1024, 4, 256>         - ", SlidingDftHop<1024, 4, 256>{});
+    fftBench<64>("SlidingDftHop<1024, 16, 256>        - ", SlidingDftHop<1024, 16, 256>{});
+    fftBench<64>("GoertzelBankHop<1024, 1, 256>       - ", GoertzelBankHop<1024, 1, 256>{});
+    fftBench<64>("GoertzelBankHop<1024, 4, 256>       - ", GoertzelBankHop<1024, 4, 256>{});
+    fftBench<64>("GoertzelBankHop<1024, 16, 256>      - ", GoertzelBankHop<1024, 16, 256>{});
+    printSeparator();
+
+    fftBench<64>("StaticQ15Roundtrip<64>              - ", StaticQ15Roundtrip<64>{});
+    fftBench<64>("StaticQ15Roundtrip<128>             - ", StaticQ15Roundtrip<128>{});
+    fftBench<64>("StaticQ15Roundtrip<256>             - ", StaticQ15Roundtrip<256>{});
+    fftBench<64>("StaticQ15Roundtrip<512>             - ", StaticQ15Roundtrip<512>{});
+    fftBench<64>("StaticQ15Roundtrip<1024>            - ", StaticQ15Roundtrip<1024>{});
+    fftBench<64>("StaticQ15Roundtrip<2048>            - ", StaticQ15Roundtrip<2048>{});
+    fftBench<64>("StaticQ15Roundtrip<4096>            - ", StaticQ15Roundtrip<4096>{});
+    printSeparator();
+}
@@ -0,0 +1,211 @@
+// Worst-case execution time harness. Drives every registry entry with each
+// adversarial stimulus and, for eurorack modules, random control jumps &
+// button presses once per block. Every block is timed individually.
+//
+// Each run is repeated with identical seeds and the per-block minimum across
+// repetitions is kept. Preemption & interrupts hit random blocks and are
+// filtered out, data dependent slow paths (subnormals, clipping branches,
+// coefficient updates) hit the same block every time and survive.
+//
+// Usage: grit-benchmark-wcet [--rate=96000] [--block=32] [--seconds=1] [--all] [filter]
+
+#include "registry.hpp"
+#include "stimulus.hpp"
+
+#include <grit/core/benchmark.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr auto Repetitions = 5;
+
+struct Options
+{
+    float sampleRate{96'000.0F};
+    int blockSize{32};
+    double seconds{1.0};
+    bool all{false};
+    std::string_view filter;
+};
+
+struct WorstCase
+{
+    char const* stimulus{""};
+    double worst{0.0};
+    double median{0.0};
+    std::size_t block{0};
+};
+
+template<typename Benchmark>
+auto runOnce(Options const& options, Stimulus const& stimulus, std::vector<double>& times) -> void
+{
+    auto const blockSize = static_cast<std::size_t>(options.blockSize);
+    auto const length    = times.size() * blockSize;
+
+    auto bench    = Benchmark{options.sampleRate, blockSize};
+    auto buffer   = std::vector<float>(blockSize * 2U);
+    auto block    = grit::StereoBlock<float>{buffer.data(), blockSize};
+    auto signal   = StimulusRng{14342};
+    auto controls = StimulusRng{4821};
+
+    for (auto b = std::size_t{0}; b < times.size(); ++b) {
+        for (auto i = std::size_t{0}; i < blockSize; ++i) {
+            auto const index = b * blockSize + i;
+            block(0, i)      = stimulus.sample(signal, index, length);
+            block(1, i)      = stimulus.sample(signal, index, length);
+        }
+
+        if constexpr (requires { bench.controls(); }) {
+            randomizeControls(controls, bench.controls());
+            pressRandomButtons(controls, bench.module());
+        }
+
+        auto const start = Clock::now();
+        bench(block);
+        auto const stop = Clock::now();
+
+        grit::doNotOptimize(buffer.front());
+        grit::doNotOptimize(buffer.back());
+
+        auto const elapsed = std::chrono::duration<double, std::nano>{stop - start}.count();
+        times[b]           = std::min(times[b], elapsed);
+    }
+}
+
+template<typename Benchmark>
+auto measure(Options const& options, Stimulus const& stimulus) -> WorstCase
+{
+    auto const numBlocks = static_cast<double>(options.sampleRate) * options.seconds / double(options.blockSize);
+    auto times           = std::vector<double>(static_cast<std::size_t>(numBlocks), 1e300);
+
+    // Throw-away run to warm up the instruction & data caches
+    auto warmup = std::vector<double>(times.size() / 8U + 1U, 1e300);
+    runOnce<Benchmark>(options, stimulus, warmup);
+
+    for (auto r{0}; r < Repetitions; ++r) {
+        runOnce<Benchmark>(options, stimulus, times);
+    }
+
+    auto const worst = std::max_element(times.begin(), times.end());
+    auto result      = WorstCase{
+        .stimulus = stimulus.name,
+        .worst    = *worst,
+        .median   = 0.0,
+        .block    = static_cast<std::size_t>(worst - times.begin()),
+    };
+
+    std::nth_element(times.begin(), times.begin() + std::ptrdiff_t(times.size() / 2), times.end());
+    result.median = times[times.size() / 2];
+    return result;
+}
+
+auto print(char const* name, Options const& options, WorstCase const& result) -> void
+{
+    auto const blockPeriod = 1e9 * double(options.blockSize) / double(options.sampleRate);
+    std::printf(
+        "%-24s %-18s Worst: %10.1f ns (%6.2f %%) - Median: %10.1f ns - Ratio: %6.2f - Block: %6zu\n",
+        name,
+        result.stimulus,
+        result.worst,
+        result.worst / blockPeriod * 100.0,
+        result.median,
+        result.median > 0.0 ? result.worst / result.median : 0.0,
+        result.block
+    );
+}
+
+auto parseOptions(int argc, char const* const* argv) -> Options
+{
+    auto options = Options{};
+    for (auto i{1}; i < argc; ++i) {
+        auto const arg   = std::string_view{argv[i]};
+        auto const value = [arg](std::string_view option) -> char const* {
+            return arg.starts_with(option) ? arg.substr(option.size()).data() : nullptr;
+        };
+
+        if (auto const* rate = value("--rate=")) {
+            options.sampleRate = std::strtof(rate, nullptr);
+        } else if (auto const* block = value("--block=")) {
+            options.blockSize = std::atoi(block);
+        } else if (auto const* seconds = value("--seconds=")) {
+            options.seconds = std::strtod(seconds, nullptr);
+        } else if (arg == "--all") {
+            options.all = true;
+        } else if (arg.starts_with("--")) {
+            std::fprintf(stderr, "unknown option: %s\n", argv[i]);
+            std::exit(EXIT_FAILURE);
+        } else {
+            options.filter = arg;
+        }
+    }
+
+    if (options.sampleRate <= 0.0F or options.blockSize <= 0 or options.seconds <= 0.0) {
+        std::fprintf(stderr, "invalid rate, block size or duration\n");
+        std::exit(EXIT_FAILURE);
+    }
+
+    if (static_cast<double>(options.sampleRate) * options.seconds < double(options.blockSize)) {
+        std::fprintf(stderr, "duration is shorter than one block\n");
+        std::exit(EXIT_FAILURE);
+    }
+
+    if (options.blockSize > benchmarkBlockSizes.back()) {
+        std::fprintf(stderr, "block size is limited to %d\n", benchmarkBlockSizes.back());
+        std::exit(EXIT_FAILURE);
+    }
+
+    return options;
+}
+
+}  // namespace
+
+auto main(int argc, char const* const* argv) -> int
+{
+#if not defined(__OPTIMIZE__)
+    std::fprintf(stderr, "WARNING: benchmark was built without optimizations\n");
+#endif
+
+    auto const options = parseOptions(argc, argv);
+    std::printf(
+        "Rate: %d - Block: %d - Duration: %.2f s - Budget: %.1f ns/block\n\n",
+        int(options.sampleRate),
+        options.blockSize,
+        options.seconds,
+        1e9 * double(options.blockSize) / double(options.sampleRate)
+    );
+
+    forEachEntry(ProcessorRegistry{}, [&options]<typename Entry> {
+        auto const name = std::string_view{Entry::name()};
+        if (not options.filter.empty() and name.find(options.filter) == std::string_view::npos) {
+            return;
+        }
+
+        auto worst = WorstCase{};
+        for (auto const& stimulus : adversarialStimuli) {
+            auto const result = measure<typename Entry::BenchmarkType>(options, stimulus);
+            if (options.all) {
+                print(Entry::name(), options, result);
+            }
+            if (result.worst > worst.worst) {
+                worst = result;
+            }
+        }
+
+        if (options.all) {
+            std::printf("\n");
+        } else {
+            print(Entry::name(), options, worst);
+        }
+    });
+
+    return EXIT_SUCCESS;
+}